@@ -183,6 +183,39 @@ namespace Utilities
              const Triangulation<dim, spacedim>                        &tria,
              const Mapping<dim, spacedim> &mapping);
 
+      /**
+       * Update the internal data structures and the communication pattern
+       * for a list of points @p points that are displaced versions of the
+       * points passed to the previous call of reinit(), as is the case, e.g.,
+       * for the points on an interface that moves a little in each time step.
+       *
+       * Instead of searching all points globally, each process that
+       * evaluated a point before checks whether the moved point is still
+       * inside the same cell or inside one of the locally owned cells that
+       * share a vertex with it. Only the points that have left this
+       * neighborhood, as well as the points that had not been found before,
+       * are located again with the global search done by reinit(), which
+       * involves exchanging bounding boxes among all processes. If there are
+       * no such points on any process, the global search is skipped
+       * altogether.
+       *
+       * The update requires that the previous call was also a call to this
+       * function, that each point found by it was associated with a single
+       * cell (see AdditionalData::enforce_unique_mapping), that the
+       * triangulation has not been changed since then, and that the number
+       * of points is the same. If this is not the case, this function does
+       * the same global search as reinit(). In contrast to reinit(), it
+       * stores a description of the point locations for the next update,
+       * which is why the first call in a sequence of moving points should
+       * already be a call to this function.
+       *
+       * @warning This is a collective call that needs to be executed by all
+       *   processors in the communicator.
+       */
+      void
+      reinit_incremental(const GridTools::Cache<dim, spacedim> &cache,
+                         const std::vector<Point<spacedim>>    &points);
+
       /**
        * Helper class to store and to access data of points positioned in
        * processed cells.
@@ -418,6 +451,17 @@ namespace Utilities
 
 
     private:
+      /**
+       * Locate @p points with a global search and set up the communication
+       * pattern via reinit(). If @p keep_point_locations is true, the
+       * description of the point locations is stored for later calls of
+       * reinit_incremental().
+       */
+      void
+      search_and_reinit(const GridTools::Cache<dim, spacedim> &cache,
+                        const std::vector<Point<spacedim>>    &points,
+                        const bool keep_point_locations);
+
       /**
        * Additional data with basic settings.
        */
@@ -489,6 +533,16 @@ namespace Utilities
        */
       std::unique_ptr<CellData> cell_data;
 
+      /**
+       * The description of the point locations the communication pattern
+       * was set up from. Only stored by reinit_incremental(), which needs it
+       * for the next update, and empty after any other call to reinit().
+       */
+      std::unique_ptr<
+        GridTools::internal::DistributedComputePointLocationsInternal<dim,
+                                                                      spacedim>>
+        point_locations;
+
       /**
        * Permutation index within a send buffer.
        */
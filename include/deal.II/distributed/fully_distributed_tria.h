@@ -211,6 +211,12 @@ namespace parallel
       /**
        * Execute repartitioning and use the partitioner attached by the
        * method set_partitioner();
+       *
+       * If the partitioner returns an empty vector, i.e., keeps the current
+       * partition, the triangulation is left untouched and neither the
+       * triangulation is rebuilt nor are the signals
+       * Triangulation::Signals::pre_distributed_repartition and
+       * Triangulation::Signals::post_distributed_repartition triggered.
        */
       void
       repartition();
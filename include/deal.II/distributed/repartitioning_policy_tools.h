@@ -15,10 +15,15 @@
 #ifndef dealii_distributed_repartitioning_policy_tools_h
 #define dealii_distributed_repartitioning_policy_tools_h
 
+#include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/tria.h>
 
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <chrono>
+#include <map>
+#include <mutex>
+
 DEAL_II_NAMESPACE_OPEN
 
 /**
@@ -177,6 +182,266 @@ namespace RepartitioningPolicyTools
       weighting_function;
   };
 
+  /**
+   * A geometric policy that orders the active locally owned cells of all
+   * processes along a Hilbert space-filling curve through their centers and
+   * cuts the curve into pieces of (approximately) equal weight, one per
+   * process. Since nearby cells are close on the curve, the resulting
+   * partitions are compact.
+   *
+   * In contrast to GridTools::partition_triangulation(), the partition is
+   * computed collectively by all processes without ever collecting the
+   * mesh, or any per-cell data, on a single process: each process computes
+   * the curve indices of its own cells, and the positions of the cuts are
+   * determined by a bisection over the index range that only needs global
+   * reductions of the weight below each candidate cut. This allows, e.g.,
+   * to read a coarse mesh into a parallel::fullydistributed::Triangulation
+   * with an arbitrary initial distribution (for example with
+   * TriangulationDescription::Utilities::load_description()) and to
+   * redistribute it with this policy via
+   * parallel::fullydistributed::Triangulation::set_partitioner() and
+   * parallel::fullydistributed::Triangulation::repartition().
+   *
+   * Cells whose centers map to the same curve index are always assigned to
+   * the same process.
+   */
+  template <int dim, int spacedim = dim>
+  class SpaceFillingCurvePolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor. If @p weighting_function is given, it is used to
+     * determine the weight of each cell as in CellWeightPolicy; otherwise
+     * all cells have the same weight.
+     */
+    SpaceFillingCurvePolicy(
+      const std::function<unsigned int(
+        const typename Triangulation<dim, spacedim>::cell_iterator &,
+        const CellStatus)> &weighting_function = {});
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * A function that gives a weight to each cell. May be empty.
+     */
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)>
+      weighting_function;
+  };
+
+
+  /**
+   * A policy that distributes the measured cost of the cells equally among
+   * the processes. In contrast to CellWeightPolicy, the user does not
+   * provide the weights but reports how long the work on the locally owned
+   * cells actually took, e.g., by timing the cell batches of a
+   * MatrixFree::cell_loop() with add_cell_range_cost() or by wrapping the
+   * worker of a WorkStream::run() call with instrument_worker():
+   * @code
+   * RepartitioningPolicyTools::MeasuredCostPolicy<dim> policy(1.2, 0.1);
+   * tria.set_partitioner(policy,
+   *                      TriangulationDescription::Settings::default_setting);
+   *
+   * for (unsigned int step = 0; step < n_steps; ++step)
+   *   {
+   *     WorkStream::run(dof_handler.begin_active(),
+   *                     dof_handler.end(),
+   *                     policy.instrument_worker(worker),
+   *                     copier,
+   *                     scratch_data,
+   *                     copy_data);
+   *     ...
+   *     // only moves cells if the measured imbalance is too large
+   *     tria.repartition();
+   *   }
+   * @endcode
+   *
+   * The costs reported between two calls of partition() are summed up per
+   * cell and then merged into a running average, with the weight of the
+   * new value given by the @p smoothing argument of the constructor, so
+   * that the policy follows costs that change over time without reacting
+   * to the noise of single measurements. Cells for which no cost has ever
+   * been reported get the average cost of the measured cells of all
+   * processes.
+   *
+   * partition() only returns a new partition if the load imbalance, i.e.,
+   * the ratio between the largest cost of any process and the average cost
+   * per process, exceeds @p imbalance_threshold. Otherwise, it returns an
+   * empty vector, in which case
+   * parallel::fullydistributed::Triangulation::repartition() leaves the
+   * triangulation untouched. To avoid repartitioning in every step if the
+   * imbalance can not be reduced below the threshold (e.g., because of
+   * single very expensive cells), the imbalance measured in the first call
+   * after a repartitioning is taken as a reference, and a new
+   * repartitioning is only triggered once the imbalance has grown by more
+   * than @p hysteresis above that reference.
+   *
+   * The costs are stored by CellId on the process that owns the cell at
+   * the time of measurement. They are not transferred when cells move to
+   * another process, so moved cells start with the average cost until new
+   * measurements are available. Reporting costs is thread-safe.
+   */
+  template <int dim, int spacedim = dim>
+  class MeasuredCostPolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor.
+     *
+     * @param imbalance_threshold The ratio of the maximal and the average
+     *   cost per process above which the cells are repartitioned.
+     * @param hysteresis The increase of the imbalance above the imbalance
+     *   reached after the last repartitioning that is necessary to trigger
+     *   another repartitioning.
+     * @param smoothing The weight, in $(0,1]$, of new measurements in the
+     *   running average of the cost of a cell. A value of one means that
+     *   only the costs of the last period are used.
+     */
+    MeasuredCostPolicy(const double imbalance_threshold = 1.1,
+                       const double hysteresis          = 0.05,
+                       const double smoothing           = 0.5);
+
+    /**
+     * Add @p cost (e.g., a time in seconds) to the cost of the cell with
+     * id @p cell_id in the current measurement period.
+     */
+    void
+    add_cell_cost(const CellId &cell_id, const double cost);
+
+    /**
+     * Add the cost @p cost, measured for the cell batches in the range
+     * @p cell_range of @p matrix_free, e.g., inside the cell operation of a
+     * MatrixFree::cell_loop(). The cost is split equally between all cells
+     * in the range.
+     */
+    template <typename MatrixFreeType>
+    void
+    add_cell_range_cost(
+      const MatrixFreeType                        &matrix_free,
+      const std::pair<unsigned int, unsigned int> &cell_range,
+      const double                                 cost);
+
+    /**
+     * Return a worker for WorkStream::run() that calls @p worker and adds
+     * the wall time spent in it to the cost of the cell it was called for.
+     */
+    template <typename Worker>
+    auto
+    instrument_worker(const Worker &worker);
+
+    /**
+     * Return the load imbalance determined in the last call of partition(),
+     * i.e., the ratio between the largest and the average cost per process.
+     */
+    double
+    get_imbalance() const;
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * Ratio of the maximal and the average cost above which the cells are
+     * repartitioned.
+     */
+    const double imbalance_threshold;
+
+    /**
+     * Growth of the imbalance relative to reference_imbalance that is
+     * necessary to trigger a repartitioning.
+     */
+    const double hysteresis;
+
+    /**
+     * Weight of new measurements in the running average.
+     */
+    const double smoothing;
+
+    /**
+     * Costs reported since the last call of partition().
+     */
+    mutable std::map<CellId, double> current_costs;
+
+    /**
+     * Mutex to guard access to current_costs.
+     */
+    mutable std::mutex mutex;
+
+    /**
+     * Running averages of the costs of the cells.
+     */
+    mutable std::map<CellId, double> smoothed_costs;
+
+    /**
+     * Imbalance determined in the last call of partition().
+     */
+    mutable double imbalance;
+
+    /**
+     * Imbalance measured after the last repartitioning, zero if the cells
+     * have not been repartitioned yet.
+     */
+    mutable double reference_imbalance;
+
+    /**
+     * Whether the next call of partition() should set reference_imbalance.
+     */
+    mutable bool measure_reference_imbalance;
+  };
+
+
+
+#ifndef DOXYGEN
+
+  template <int dim, int spacedim>
+  template <typename MatrixFreeType>
+  void
+  MeasuredCostPolicy<dim, spacedim>::add_cell_range_cost(
+    const MatrixFreeType                        &matrix_free,
+    const std::pair<unsigned int, unsigned int> &cell_range,
+    const double                                 cost)
+  {
+    unsigned int n_cells = 0;
+    for (unsigned int batch = cell_range.first; batch < cell_range.second;
+         ++batch)
+      n_cells += matrix_free.n_active_entries_per_cell_batch(batch);
+
+    if (n_cells == 0)
+      return;
+
+    for (unsigned int batch = cell_range.first; batch < cell_range.second;
+         ++batch)
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++v)
+        add_cell_cost(matrix_free.get_cell_iterator(batch, v)->id(),
+                      cost / n_cells);
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Worker>
+  auto
+  MeasuredCostPolicy<dim, spacedim>::instrument_worker(const Worker &worker)
+  {
+    return [this, worker](const auto &cell,
+                          auto       &scratch_data,
+                          auto       &copy_data) {
+      const auto start = std::chrono::steady_clock::now();
+      worker(cell, scratch_data, copy_data);
+      add_cell_cost(cell->id(),
+                    std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count());
+    };
+  }
+
+#endif
+
 } // namespace RepartitioningPolicyTools
 
 DEAL_II_NAMESPACE_CLOSE
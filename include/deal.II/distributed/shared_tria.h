@@ -120,7 +120,8 @@ namespace parallel
        *
        * The constructor requires that exactly one of
        * <code>partition_auto</code>, <code>partition_metis</code>,
-       * <code>partition_zorder</code>, <code>partition_zoltan</code> and
+       * <code>partition_zorder</code>, <code>partition_zoltan</code>,
+       * <code>partition_hilbert</code> and
        * <code>partition_custom_signal</code> is set. If
        * <code>partition_auto</code> is chosen, it will use
        * <code>partition_zoltan</code> (if available), then
@@ -229,6 +230,19 @@ namespace parallel
          * active cell partitioning method.
          */
         construct_multigrid_hierarchy = 0x8,
+
+        /**
+         * Partition active cells along a Hilbert space-filling curve through
+         * the cell centers, see GridTools::partition_triangulation_hilbert().
+         * In contrast to @p partition_metis and @p partition_zoltan, this
+         * does not need an external library, and the work is shared among
+         * the threads of each process. The resulting partitions are
+         * typically more compact than the ones of @p partition_zorder, in
+         * particular for coarse meshes with many cells. Cell weights
+         * attached to the Triangulation::Signals::weight signal are taken
+         * into account.
+         */
+        partition_hilbert = 0x10,
       };
 
 
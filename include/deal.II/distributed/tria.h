@@ -32,6 +32,7 @@
 
 #include <functional>
 #include <list>
+#include <optional>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -345,7 +346,20 @@ namespace parallel
          * active cell that owns an arbitrary point in case all attached
          * manifolds are flat.
          */
-        communicate_vertices_to_p4est = 0x8
+        communicate_vertices_to_p4est = 0x8,
+        /**
+         * Setting this flag will make save() write the fixed size cell data
+         * in an indexed layout, in which the data attached by every
+         * SolutionTransfer, CellDataTransfer, or other callback registered
+         * via register_data_attach() is stored in a separate, contiguous
+         * block of the checkpoint file and the header records the offset of
+         * each block. Checkpoints written this way can be read with
+         * load(const std::string &, const std::vector<unsigned int> &),
+         * which only reads the selected fields, each with a single
+         * contiguous read per process independently of the number of
+         * processes that wrote the file.
+         */
+        indexed_checkpoints = 0x10
       };
 
 
@@ -662,6 +676,29 @@ namespace parallel
       virtual void
       load(const std::string &file_basename) override;
 
+      /**
+       * Same as above, but only load a subset of the fixed size cell data
+       * that was attached at the time of saving. The entries of
+       * @p fixed_size_attachments are the indices of the fixed size
+       * attachments in the order in which they were registered via
+       * register_data_attach() before save() was called (e.g., the order in
+       * which SolutionTransfer::prepare_for_serialization() was called on
+       * the different SolutionTransfer objects). After this function
+       * returns, the selected data has to be deserialized in the order given
+       * in @p fixed_size_attachments; data that was not selected is never
+       * read from the file system. Variable size data, if any was saved, is
+       * always loaded.
+       *
+       * This function requires that the checkpoint has been written with
+       * the Settings::indexed_checkpoints flag set. As for the function
+       * above, the number of MPI processes does not need to match the one
+       * at the time of saving: every process only reads its own range of
+       * cells of each selected field.
+       */
+      void
+      load(const std::string               &file_basename,
+           const std::vector<unsigned int> &fixed_size_attachments);
+
       /**
        * Load the refinement information from a given parallel forest. This
        * forest might be obtained from the function call to
@@ -728,6 +765,16 @@ namespace parallel
        */
       Settings settings;
 
+      /**
+       * Implementation of the load() functions above. If
+       * @p fixed_size_attachments does not hold a value, all attached data is
+       * loaded.
+       */
+      void
+      load_implementation(
+        const std::string                              &file_basename,
+        const std::optional<std::vector<unsigned int>> &fixed_size_attachments);
+
       /**
        * A flag that indicates whether the triangulation has actual content.
        */
@@ -890,7 +937,8 @@ namespace parallel
         mesh_reconstruction_after_repartitioning = 0x1,
         construct_multigrid_hierarchy            = 0x2,
         no_automatic_repartitioning              = 0x4,
-        communicate_vertices_to_p4est            = 0x8
+        communicate_vertices_to_p4est            = 0x8,
+        indexed_checkpoints                      = 0x10
       };
 
       /**
@@ -1025,7 +1073,8 @@ namespace parallel
         mesh_reconstruction_after_repartitioning = 0x1,
         construct_multigrid_hierarchy            = 0x2,
         no_automatic_repartitioning              = 0x4,
-        communicate_vertices_to_p4est            = 0x8
+        communicate_vertices_to_p4est            = 0x8,
+        indexed_checkpoints                      = 0x10
       };
 
       /**
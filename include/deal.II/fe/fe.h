@@ -50,6 +50,8 @@ namespace NonMatching
 }
 template <int dim, int spacedim>
 class FESystem;
+template <int dim, typename Number>
+class FEValuesBatch;
 #endif
 
 /**
@@ -3079,6 +3081,8 @@ protected:
   friend class FESubfaceValues<dim, spacedim>;
   friend class NonMatching::FEImmersedSurfaceValues<dim>;
   friend class FESystem<dim, spacedim>;
+  template <int, typename>
+  friend class FEValuesBatch;
 
   // explicitly check for sensible template arguments, but not on windows
   // because MSVC creates bogus warnings during normal compilation
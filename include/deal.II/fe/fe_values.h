@@ -46,6 +46,7 @@
 #include <algorithm>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -141,6 +142,50 @@ public:
   const Quadrature<dim> &
   get_quadrature() const;
 
+  /**
+   * Let this object store the mapped shape function data and the mapping
+   * data of up to @p max_n_cells cells that are not translations of each
+   * other. The CellSimilarity check only compares the present cell with the
+   * one visited just before. With this cache, a call to reinit() on a cell
+   * that is a translation of any of the stored cells copies the stored
+   * gradients, Jacobians, and JxW values rather than computing them, and
+   * only shifts the quadrature points. On structured or mostly Cartesian
+   * meshes, where only a few such classes of cells exist, this makes
+   * reinit() much cheaper, regardless of the order in which the cells are
+   * visited.
+   *
+   * The cells are compared by the positions of their vertices relative to
+   * the first vertex. This is only valid if the mapping of a cell is
+   * determined by its vertices, so the cache is only used for MappingQ of
+   * degree one and for MappingCartesian. The shape functions in real space
+   * must also not depend on the position of the cell, which is the case for
+   * elements derived from FE_Poly, like FE_Q and FE_DGQ, and for FESystem
+   * objects built from such elements. For other combinations, as well as if
+   * no mapping related data is requested through the update flags, this
+   * function has no effect and reinit() works as before.
+   *
+   * Passing zero disables the cache, which is the default, and releases the
+   * stored data. Each stored cell takes about as much memory as this object
+   * itself. As with the CellSimilarity check, the results may differ in the
+   * last digits from the ones computed without the cache. Since the stored
+   * data are the ones of the first cell of each class visited, they depend
+   * on the order in which cells are visited. For this reason, the cache is
+   * subject to the same rules as the CellSimilarity check: it is only used
+   * if the program runs with a single thread or if
+   * FEValuesBase::always_allow_check_for_cell_similarity() has been called
+   * with argument `true`.
+   *
+   * @note The setting is a property of this object only. In particular, it
+   * is not carried over to the FEValues objects that are created when
+   * copying the scratch data of WorkStream::run() or
+   * MeshWorker::mesh_loop() for each thread, since these are constructed
+   * from the mapping, finite element, quadrature formula, and update flags
+   * of the original object. Call this function in the copy constructor of
+   * the scratch data if the copies should use the cache as well.
+   */
+  void
+  set_similarity_cache_size(const unsigned int max_n_cells);
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object.
@@ -185,6 +230,65 @@ private:
    */
   void
   do_reinit();
+
+  /**
+   * The data of a cell stored by set_similarity_cache_size(), together with
+   * the geometry of the cell needed to recognize its translations.
+   */
+  struct SimilarityCacheEntry
+  {
+    ReferenceCell                    reference_cell;
+    bool                             direction_flag;
+    Point<spacedim>                  first_vertex;
+    std::vector<Tensor<1, spacedim>> vertex_offsets;
+    double                           tolerance_square;
+
+    internal::FEValuesImplementation::MappingRelatedData<dim, spacedim>
+      mapping_output;
+    internal::FEValuesImplementation::FiniteElementRelatedData<dim, spacedim>
+      finite_element_output;
+  };
+
+  /**
+   * The maximal number of entries in similarity_cache, or zero if the cache
+   * is not used.
+   */
+  unsigned int similarity_cache_size;
+
+  /**
+   * The cells whose data are reused by reinit() for their translations.
+   */
+  std::vector<SimilarityCacheEntry> similarity_cache;
+
+  /**
+   * The indices of the entries in similarity_cache, sorted by the key
+   * returned by compute_similarity_cache_key() for the respective cell.
+   */
+  std::unordered_multimap<std::size_t, unsigned int> similarity_cache_index;
+
+  /**
+   * Return a hash of the reference cell, the orientation, and the vertex
+   * positions relative to the first vertex of the present cell. The vertex
+   * offsets are rounded to a grid that is much coarser than the tolerance
+   * used to compare cells, so that translations of a cell get the same key.
+   */
+  std::size_t
+  compute_similarity_cache_key() const;
+
+  /**
+   * Look for a stored cell of which the present cell is a translation. If
+   * one is found, copy its data into the output objects, shift the
+   * quadrature points, and return the index of the entry. Otherwise return
+   * numbers::invalid_unsigned_int.
+   */
+  unsigned int
+  reinit_from_similarity_cache();
+
+  /**
+   * Store the data just computed for the present cell in similarity_cache.
+   */
+  void
+  add_to_similarity_cache();
 };
 
 
@@ -1773,16 +1773,16 @@ protected:
   check_cell_similarity(
     const typename Triangulation<dim, spacedim>::cell_iterator &cell);
 
-private:
   /**
-   * A cache for all possible FEValuesViews objects.
+   * Whether checking for cell similarity is allowed.
    */
-  dealii::internal::FEValuesViews::Cache<dim, spacedim> fe_values_views_cache;
+  bool check_for_cell_similarity_allowed;
 
+private:
   /**
-   * Whether checking for cell similarity is allowed.
+   * A cache for all possible FEValuesViews objects.
    */
-  bool check_for_cell_similarity_allowed;
+  dealii::internal::FEValuesViews::Cache<dim, spacedim> fe_values_views_cache;
 
   // Make the view classes friends of this class, since they access internal
   // data.
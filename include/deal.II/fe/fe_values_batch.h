@@ -0,0 +1,399 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/std_cxx20/iota_view.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_update_flags.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class similar to FEValues that evaluates the shape functions, their
+ * gradients, the quadrature points, and the JxW values on a batch of up to
+ * VectorizedArray::size() cells at once. All quantities are returned as
+ * VectorizedArray objects in which each lane refers to one of the cells of
+ * the batch. This allows to write matrix-based assembly loops in which the
+ * arithmetic of the innermost loops runs on all cells of a batch with SIMD
+ * instructions, without moving to the matrix-free framework:
+ * @code
+ *   FEValuesBatch<dim> fe_values(mapping, fe, quadrature,
+ *                                update_gradients | update_JxW_values);
+ *   const unsigned int n_lanes = FEValuesBatch<dim>::n_lanes;
+ *   Table<2, VectorizedArray<double>> cell_matrix(dofs_per_cell,
+ *                                                 dofs_per_cell);
+ *
+ *   for (unsigned int c = 0; c < cells.size(); c += n_lanes)
+ *     {
+ *       const unsigned int n_cells =
+ *         std::min<unsigned int>(n_lanes, cells.size() - c);
+ *       fe_values.reinit(make_array_view(cells, c, n_cells));
+ *
+ *       cell_matrix.fill(VectorizedArray<double>());
+ *       for (const unsigned int q : fe_values.quadrature_point_indices())
+ *         for (const unsigned int i : fe_values.dof_indices())
+ *           for (const unsigned int j : fe_values.dof_indices())
+ *             cell_matrix(i, j) += fe_values.shape_grad(i, q) *
+ *                                  fe_values.shape_grad(j, q) *
+ *                                  fe_values.JxW(q);
+ *
+ *       for (unsigned int v = 0; v < n_cells; ++v)
+ *         {
+ *           // copy lane v of cell_matrix into a FullMatrix<double> and
+ *           // distribute it for the cell cells[c + v]
+ *         }
+ *     }
+ * @endcode
+ *
+ * The Jacobians of the cells are computed lane by lane with the given
+ * Mapping, so any mapping can be used. The transformation of the gradients
+ * of the shape functions to the real cells, which is the most expensive
+ * part of FEValues::reinit() for elements of higher degree, is then done for
+ * all cells of the batch at once. The values of the shape functions do not
+ * depend on the cell and are computed only once in the constructor.
+ *
+ * If a batch contains fewer cells than there are lanes, the data of the
+ * last cell is repeated in the unused lanes. The entries computed in these
+ * lanes must be ignored.
+ *
+ * The class only supports elements whose shape functions on the real cell
+ * are the shape functions on the reference cell composed with the inverse
+ * of the mapping, i.e., elements derived from FE_Poly like FE_Q, FE_DGQ, or
+ * FE_SimplexP, and FESystem objects built from such elements. Elements that
+ * rescale their shape functions by the size of the cell, like FE_Hermite,
+ * are not supported. The supported update flags are update_values,
+ * update_gradients, update_quadrature_points, and update_JxW_values.
+ *
+ * @ingroup feaccess
+ */
+template <int dim, typename Number = double>
+class FEValuesBatch
+{
+public:
+  /**
+   * The vectorized data type in which all quantities are returned.
+   */
+  using VectorizedArrayType = VectorizedArray<Number>;
+
+  /**
+   * The number of cells that are processed at once.
+   */
+  static constexpr unsigned int n_lanes = VectorizedArrayType::size();
+
+  /**
+   * Constructor. The arguments have the same meaning as for FEValues.
+   */
+  FEValuesBatch(const Mapping<dim>       &mapping,
+                const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Compute the data for the cells in @p cells, whose number must be
+   * between one and #n_lanes. Lane @p v of all quantities returned by this
+   * object after this call refers to the cell `cells[v]`. The cells may be
+   * iterators into a Triangulation or a DoFHandler.
+   */
+  template <typename CellIteratorType>
+  void
+  reinit(const ArrayView<const CellIteratorType> &cells);
+
+  /**
+   * Return the number of cells that were passed to the last call of
+   * reinit().
+   */
+  unsigned int
+  n_active_lanes() const;
+
+  /**
+   * Value of shape function @p i at quadrature point @p q. For vector-valued
+   * elements, this is the value of the only nonzero component of the shape
+   * function. The value is the same in all lanes.
+   */
+  const VectorizedArrayType &
+  shape_value(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Gradient of shape function @p i at quadrature point @p q on the cells of
+   * the batch. For vector-valued elements, this is the gradient of the only
+   * nonzero component of the shape function.
+   */
+  const Tensor<1, dim, VectorizedArrayType> &
+  shape_grad(const unsigned int i, const unsigned int q) const;
+
+  /**
+   * Location of quadrature point @p q on the cells of the batch.
+   */
+  const Point<dim, VectorizedArrayType> &
+  quadrature_point(const unsigned int q) const;
+
+  /**
+   * The product of the Jacobian determinant and the quadrature weight of
+   * quadrature point @p q on the cells of the batch.
+   */
+  const VectorizedArrayType &
+  JxW(const unsigned int q) const;
+
+  /**
+   * Return an object that can be used in range-based `for` loops over all
+   * shape functions, like FEValuesBase::dof_indices().
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  dof_indices() const;
+
+  /**
+   * Return an object that can be used in range-based `for` loops over all
+   * quadrature points, like FEValuesBase::quadrature_point_indices().
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  quadrature_point_indices() const;
+
+  /**
+   * Return the finite element in use.
+   */
+  const FiniteElement<dim> &
+  get_fe() const;
+
+  /**
+   * Return the quadrature formula in use.
+   */
+  const Quadrature<dim> &
+  get_quadrature() const;
+
+  /**
+   * Return the update flags given to the constructor.
+   */
+  UpdateFlags
+  get_update_flags() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * The number of shape functions per cell.
+   */
+  const unsigned int dofs_per_cell;
+
+  /**
+   * The number of quadrature points per cell.
+   */
+  const unsigned int n_quadrature_points;
+
+private:
+  /**
+   * Return whether the shape functions of @p fe on a real cell are the shape
+   * functions on the reference cell composed with the inverse of the
+   * mapping, so that their gradients are obtained by the covariant
+   * transformation. Elements derived from FE_Poly that additionally rescale
+   * their shape functions by the cell size, like FE_Hermite, request
+   * update_rescale and are rejected.
+   */
+  static bool
+  is_covariant_scalar_element(const FiniteElement<dim> &fe);
+
+  /**
+   * Copy the mapping data computed by #fe_values into lane @p lane.
+   */
+  void
+  fill_lane(const unsigned int lane);
+
+  /**
+   * Fill the unused lanes and compute the gradients of the shape functions
+   * on all lanes.
+   */
+  void
+  finish_reinit(const unsigned int n_cells);
+
+  /**
+   * The update flags given to the constructor.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * An FEValues object that computes the Jacobians, quadrature points, and
+   * JxW values of one cell at a time.
+   */
+  FEValues<dim> fe_values;
+
+  /**
+   * The number of cells passed to the last call of reinit().
+   */
+  unsigned int n_cells;
+
+  /**
+   * The gradients of the shape functions on the reference cell, indexed by
+   * shape function and quadrature point.
+   */
+  Table<2, Tensor<1, dim, Number>> unit_gradients;
+
+  /**
+   * The values of the shape functions, indexed by shape function and
+   * quadrature point.
+   */
+  Table<2, VectorizedArrayType> values;
+
+  /**
+   * The gradients of the shape functions on the cells of the batch, indexed
+   * by shape function and quadrature point.
+   */
+  Table<2, Tensor<1, dim, VectorizedArrayType>> gradients;
+
+  /**
+   * The transpose of the inverse Jacobians at the quadrature points, i.e.,
+   * the matrices that map the gradients on the reference cell to the
+   * gradients on the cells of the batch.
+   */
+  AlignedVector<Tensor<2, dim, VectorizedArrayType>> inverse_jacobians;
+
+  /**
+   * The quadrature points on the cells of the batch.
+   */
+  AlignedVector<Point<dim, VectorizedArrayType>> quadrature_points;
+
+  /**
+   * The JxW values on the cells of the batch.
+   */
+  AlignedVector<VectorizedArrayType> JxW_values;
+};
+
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number>
+template <typename CellIteratorType>
+inline void
+FEValuesBatch<dim, Number>::reinit(
+  const ArrayView<const CellIteratorType> &cells)
+{
+  Assert(cells.size() > 0 && cells.size() <= n_lanes,
+         ExcMessage("The number of cells in a batch must be between one and "
+                    "the number of lanes of VectorizedArray."));
+
+  if (fe_values.get_update_flags() & update_mapping)
+    for (unsigned int v = 0; v < cells.size(); ++v)
+      {
+        fe_values.reinit(cells[v]);
+        fill_lane(v);
+      }
+
+  finish_reinit(cells.size());
+}
+
+
+
+template <int dim, typename Number>
+inline unsigned int
+FEValuesBatch<dim, Number>::n_active_lanes() const
+{
+  return n_cells;
+}
+
+
+
+template <int dim, typename Number>
+inline const typename FEValuesBatch<dim, Number>::VectorizedArrayType &
+FEValuesBatch<dim, Number>::shape_value(const unsigned int i,
+                                        const unsigned int q) const
+{
+  Assert(update_flags & update_values,
+         (typename FEValuesBase<dim>::ExcAccessToUninitializedField(
+           "update_values")));
+  return values(i, q);
+}
+
+
+
+template <int dim, typename Number>
+inline const Tensor<1,
+                    dim,
+                    typename FEValuesBatch<dim, Number>::VectorizedArrayType> &
+FEValuesBatch<dim, Number>::shape_grad(const unsigned int i,
+                                       const unsigned int q) const
+{
+  Assert(update_flags & update_gradients,
+         (typename FEValuesBase<dim>::ExcAccessToUninitializedField(
+           "update_gradients")));
+  return gradients(i, q);
+}
+
+
+
+template <int dim, typename Number>
+inline const Point<dim,
+                   typename FEValuesBatch<dim, Number>::VectorizedArrayType> &
+FEValuesBatch<dim, Number>::quadrature_point(const unsigned int q) const
+{
+  Assert(update_flags & update_quadrature_points,
+         (typename FEValuesBase<dim>::ExcAccessToUninitializedField(
+           "update_quadrature_points")));
+  AssertIndexRange(q, n_quadrature_points);
+  return quadrature_points[q];
+}
+
+
+
+template <int dim, typename Number>
+inline const typename FEValuesBatch<dim, Number>::VectorizedArrayType &
+FEValuesBatch<dim, Number>::JxW(const unsigned int q) const
+{
+  Assert(update_flags & update_JxW_values,
+         (typename FEValuesBase<dim>::ExcAccessToUninitializedField(
+           "update_JxW_values")));
+  AssertIndexRange(q, n_quadrature_points);
+  return JxW_values[q];
+}
+
+
+
+template <int dim, typename Number>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEValuesBatch<dim, Number>::dof_indices() const
+{
+  return {0U, dofs_per_cell};
+}
+
+
+
+template <int dim, typename Number>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FEValuesBatch<dim, Number>::quadrature_point_indices() const
+{
+  return {0U, n_quadrature_points};
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -506,6 +506,30 @@ public:
     const ArrayView<const Point<spacedim>>                     &real_points,
     const ArrayView<Point<dim>> &unit_points) const;
 
+  /**
+   * Map a batch of points from real to reference coordinates, where each
+   * point comes with its own cell: The point `real_points[i]` is transformed
+   * with respect to the cell `cells[i]`, and the result is written to
+   * `unit_points[i]`. As in transform_points_real_to_unit_cell(), this
+   * function does not throw if the transformation fails for a point, but
+   * sets the first entry of the respective `unit_points[i]` to
+   * std::numeric_limits<double>::infinity().
+   *
+   * The default implementation calls transform_points_real_to_unit_cell()
+   * for each range of consecutive points that share the same cell. Derived
+   * classes like MappingQ and MappingCartesian provide faster
+   * implementations that work on the points of several cells at once, e.g.
+   * by vectorizing the Newton iteration over points in different cells. This
+   * is beneficial when there are only a few points per cell, as is typical
+   * when searching for particles or arbitrary evaluation points.
+   */
+  virtual void
+  transform_points_real_to_unit_cells(
+    const ArrayView<const typename Triangulation<dim, spacedim>::cell_iterator>
+                                           &cells,
+    const ArrayView<const Point<spacedim>> &real_points,
+    const ArrayView<Point<dim>>            &unit_points) const;
+
   /**
    * Transform the point @p p on the real @p cell to the corresponding point
    * on the reference cell, and then project this point to a (dim-1)-dimensional
@@ -116,6 +116,14 @@ public:
     const ArrayView<const Point<spacedim>>                     &real_points,
     const ArrayView<Point<dim>> &unit_points) const override;
 
+  // for documentation, see the Mapping base class
+  virtual void
+  transform_points_real_to_unit_cells(
+    const ArrayView<const typename Triangulation<dim, spacedim>::cell_iterator>
+                                           &cells,
+    const ArrayView<const Point<spacedim>> &real_points,
+    const ArrayView<Point<dim>>            &unit_points) const override;
+
   /**
    * @}
    */
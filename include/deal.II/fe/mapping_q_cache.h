@@ -25,6 +25,9 @@
 
 #include <deal.II/grid/tria.h>
 
+#include <atomic>
+#include <mutex>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -47,6 +50,14 @@ class DoFHandler;
  * which is used in all operations of MappingQ. The information of the
  * mapping is pre-computed by the MappingQCache::initialize() function.
  *
+ * Alternatively, the cache can be filled on demand by the
+ * MappingQCache::initialize_lazily() functions: The mapping support points of
+ * a cell are then computed the first time the cell is visited, and are reused
+ * for all subsequent visits. This allows to wrap any mapping, e.g. a
+ * MappingFE, MappingManifold, or a MappingQ on a triangulation with expensive
+ * manifold descriptions, into a MappingQCache without paying for cells that
+ * are never visited.
+ *
  * The use of this class is discussed extensively in step-65.
  */
 template <int dim, int spacedim = dim>
@@ -121,6 +132,53 @@ public:
                const typename Triangulation<dim, spacedim>::cell_iterator &)>
                &compute_points_on_cell);
 
+  /**
+   * Like the first initialize() function, but compute the mapping support
+   * points of a cell only when they are requested for the first time, e.g.,
+   * by a call to FEValues::reinit(). The result is stored and reused for all
+   * later requests on the same cell. A copy of @p mapping is stored in this
+   * object, so @p mapping need not outlive this object.
+   *
+   * As with initialize(), this object does not reproduce @p mapping
+   * exactly: the geometry it describes is the polynomial interpolation of
+   * degree get_degree() of @p mapping at the mapping support points. Only
+   * if @p mapping is a MappingQ of the same degree are the two identical.
+   *
+   * The cache may be filled concurrently from several threads, e.g., inside
+   * WorkStream::run() or MeshWorker::mesh_loop(). If two threads visit the
+   * same cell for the first time at the same time, both compute the points,
+   * but only one of the results is stored.
+   *
+   * @note Upon the signal Triangulation::Signals::any_change of the
+   * underlying triangulation, all points computed so far are discarded and
+   * the cache is resized to the new triangulation. The object stays usable
+   * without calling this function again and computes the points of the
+   * cells of the changed triangulation on demand.
+   */
+  void
+  initialize_lazily(const Mapping<dim, spacedim>       &mapping,
+                    const Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * Like the second initialize() function, but call @p compute_points_on_cell
+   * for a cell only when its mapping support points are requested for the
+   * first time. The function is stored in this object and may be called from
+   * several threads at once, so it must not write into shared data.
+   *
+   * @note Upon the signal Triangulation::Signals::any_change of the
+   * underlying triangulation, all points computed so far are discarded and
+   * the cache is resized to the new triangulation. The stored function is
+   * then called again for the cells of the changed triangulation, so any
+   * data it refers to must remain valid for the lifetime of this object or
+   * until the next call to one of the initialization functions.
+   */
+  void
+  initialize_lazily(
+    const Triangulation<dim, spacedim> &triangulation,
+    const std::function<std::vector<Point<spacedim>>(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>
+      &compute_points_on_cell);
+
   /**
    * Initialize the data cache by computing the mapping support points for all
    * cells (on all levels) of the given triangulation and a given @p mapping
@@ -215,6 +273,49 @@ protected:
     const override;
 
 private:
+  /**
+   * Return the cached mapping support points of @p cell. If the cache is
+   * filled lazily and the points of @p cell have not been computed yet,
+   * compute and store them first.
+   */
+  const std::vector<Point<spacedim>> &
+  get_cached_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
+
+  /**
+   * Discard all points stored by the lazily filled cache and resize it to
+   * the cells of @p triangulation, keeping the function that computes the
+   * points. Called by initialize_lazily() and whenever @p triangulation
+   * changes.
+   */
+  void
+  reset_lazy_cache(const Triangulation<dim, spacedim> &triangulation);
+
+  /**
+   * The data needed to fill the cache on demand, set up by
+   * initialize_lazily().
+   */
+  struct LazyFillData
+  {
+    /**
+     * The function computing the mapping support points of a cell.
+     */
+    std::function<std::vector<Point<spacedim>>(
+      const typename Triangulation<dim, spacedim>::cell_iterator &)>
+      compute_points_on_cell;
+
+    /**
+     * A flag for each cell (on each level) that is set once the entry in
+     * support_point_cache has been filled.
+     */
+    std::vector<std::unique_ptr<std::atomic<bool>[]>> is_filled;
+
+    /**
+     * A mutex guarding the write access to support_point_cache.
+     */
+    std::mutex mutex;
+  };
+
   /**
    * The point cache filled upon calling initialize(). It is made a shared
    * pointer to allow several instances (created via clone()) to share this
@@ -223,6 +324,13 @@ private:
   std::shared_ptr<std::vector<std::vector<std::vector<Point<spacedim>>>>>
     support_point_cache;
 
+  /**
+   * The data for filling the cache on demand. Only set if the object was
+   * initialized by one of the initialize_lazily() functions. Like
+   * support_point_cache, it is shared between copies of this object.
+   */
+  std::shared_ptr<LazyFillData> lazy_fill_data;
+
   /**
    * The connection to Triangulation::signals::any that must be reset once
    * this class goes out of scope.
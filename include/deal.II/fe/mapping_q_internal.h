@@ -470,14 +470,17 @@ namespace internal
 
     /**
      * Implementation of transform_real_to_unit_cell for either type double
-     * or VectorizedArray<double>
+     * or VectorizedArray<double>. The mapping support points @p points are
+     * usually given as `Point<spacedim>` and shared by all SIMD lanes, but
+     * can also be of type `Point<spacedim, VectorizedArray<double>>` to
+     * transform points located in different cells at once.
      */
-    template <int dim, int spacedim, typename Number>
+    template <int dim, int spacedim, typename Number, typename Number2>
     inline Point<dim, Number>
     do_transform_real_to_unit_cell_internal(
       const Point<spacedim, Number>                      &p,
       const Point<dim, Number>                           &initial_p_unit,
-      const ArrayView<const Point<spacedim>>             &points,
+      const ArrayView<const Point<spacedim, Number2>>    &points,
       const std::vector<Polynomials::Polynomial<double>> &polynomials_1d,
       const std::vector<unsigned int>                    &renumber,
       const bool print_iterations_to_deallog = false)
@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/point.h>
@@ -43,6 +44,7 @@
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_vector.h>
 
+#include <deal.II/numerics/bounding_volume_hierarchy.h>
 #include <deal.II/numerics/rtree.h>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -1230,6 +1232,17 @@ namespace GridTools
    * optionally an RTree constructed from the used vertices of the
    * Triangulation.
    *
+   * If the search starting from the vertex closest to the point fails, the
+   * function falls back to a search over all cells. If
+   * @p get_cell_bounding_boxes_bvh is given, it is called in this case to
+   * obtain a hierarchy of boxes around all active cells of the
+   * triangulation (such as the one returned by
+   * GridTools::Cache::get_cell_bounding_boxes_bvh()), and only the cells
+   * whose box contains the point are checked, which reduces the cost of
+   * this fallback from linear to logarithmic in the number of cells. Since
+   * the function is only called if the fallback is needed, the hierarchy
+   * can be built lazily.
+   *
    * @note All of these structures can be queried from a
    * GridTools::Cache object. Note, however, that in this case MeshType
    * has to be Triangulation, so that it might be more appropriate to directly
@@ -1266,7 +1279,11 @@ namespace GridTools
       const RTree<
         std::pair<BoundingBox<spacedim>,
                   typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        *relevant_cell_bounding_boxes_rtree = nullptr);
+        *relevant_cell_bounding_boxes_rtree = nullptr,
+      const std::function<const BoundingVolumeHierarchy<
+        spacedim,
+        typename Triangulation<dim, spacedim>::active_cell_iterator> &()>
+        &get_cell_bounding_boxes_bvh = {});
 
   /**
    * As compared to the functions above, this function identifies all active
@@ -1967,6 +1984,61 @@ namespace GridTools
                                  Triangulation<dim, spacedim> &triangulation,
                                  const bool group_siblings = true);
 
+  /**
+   * Partition the active cells of the triangulation by sorting them along a
+   * Hilbert space-filling curve through the cell centers and cutting the
+   * curve into @p n_partitions pieces of (approximately) equal weight. After
+   * calling this function, the subdomain ids of all active cells will have
+   * values between zero and @p n_partitions-1.
+   *
+   * The weight of each cell is given by @p cell_weights, indexed by the
+   * active cell index; if the vector is empty, all cells have the same
+   * weight.
+   *
+   * In contrast to partition_triangulation(), this function does not need
+   * an external graph partitioner, and the expensive steps (the computation
+   * of the cell centers and of their indices on the curve) are run in
+   * parallel on the available threads. The result only depends on the
+   * triangulation and the weights, and not on the number of threads, so that
+   * all processes that own the same triangulation compute the same
+   * partition. This makes the function suitable as the partitioner of a
+   * parallel::shared::Triangulation, see
+   * parallel::shared::Triangulation::partition_hilbert.
+   */
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(
+    const unsigned int               n_partitions,
+    Triangulation<dim, spacedim>    &triangulation,
+    const std::vector<unsigned int> &cell_weights = {});
+
+  namespace internal
+  {
+    /**
+     * The number of bits per coordinate direction used by
+     * compute_hilbert_keys(). All keys are less than
+     * $2^{\text{spacedim} \cdot \text{hilbert\_key\_bits\_per\_dim}}$.
+     */
+    template <int spacedim>
+    constexpr int hilbert_key_bits_per_dim = 63 / spacedim;
+
+    /**
+     * Compute for each of the @p points its index on a Hilbert
+     * space-filling curve through @p bounding_box, packed into a single
+     * integer by Utilities::pack_integers(), and store it in the
+     * corresponding entry of @p keys. Sorting points by their keys sorts
+     * them along the curve.
+     *
+     * Each point is treated independently of the others, so the function
+     * can be called for subranges of a set of points in parallel.
+     */
+    template <int spacedim>
+    void
+    compute_hilbert_keys(const ArrayView<const Point<spacedim>> &points,
+                         const BoundingBox<spacedim>            &bounding_box,
+                         const ArrayView<std::uint64_t>         &keys);
+  } // namespace internal
+
   /**
    * Partitions the cells of a multigrid hierarchy by assigning level subdomain
    * ids using the "youngest child" rule, that is, each cell in the hierarchy is
@@ -29,6 +29,7 @@
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
 
+#include <deal.II/numerics/bounding_volume_hierarchy.h>
 #include <deal.II/numerics/rtree.h>
 
 #include <boost/signals2.hpp>
@@ -55,6 +56,17 @@ namespace GridTools
    * changed due to a Triangulation::Signals::any_change() signal being
    * triggered.
    *
+   * When a serial Triangulation is refined or coarsened, the vertex to cell
+   * map, the vertex to cell centers directions, the used vertices and their
+   * RTree, and the RTrees of the cell bounding boxes are not rebuilt from
+   * scratch. Instead, the cells that are about to change are recorded when
+   * the Triangulation::Signals::pre_refinement() signal is triggered, and
+   * only the entries of these cells and of their neighbors are updated once
+   * the refinement has been executed. This makes adaptive computations that
+   * change only a small part of the mesh in each cycle considerably cheaper.
+   * All other data structures, and all data structures of parallel
+   * triangulations, are recomputed on the next access as usual.
+   *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
@@ -145,6 +157,23 @@ namespace GridTools
                 typename Triangulation<dim, spacedim>::active_cell_iterator>> &
     get_cell_bounding_boxes_rtree() const;
 
+    /**
+     * Return the cached BoundingVolumeHierarchy of the bounding boxes of all
+     * active cells of the stored triangulation, as computed by the stored
+     * mapping. In contrast to the RTree returned by
+     * get_cell_bounding_boxes_rtree(), the boxes are enlarged by ten percent
+     * of their size in each direction, so that they also contain the parts
+     * of curved cells that bulge out of the bounding box of the mapping
+     * support points. The hierarchy is optimized for finding the cells whose
+     * box contains a given point, which is used by
+     * GridTools::find_active_cell_around_point() when the search starting
+     * from the closest vertex fails.
+     */
+    const BoundingVolumeHierarchy<
+      spacedim,
+      typename Triangulation<dim, spacedim>::active_cell_iterator> &
+    get_cell_bounding_boxes_bvh() const;
+
     /**
      * Return the cached RTree object of bounding boxes containing locally owned
      * active cells, constructed using the active cell iterators of the stored
@@ -238,6 +267,70 @@ namespace GridTools
      */
     mutable std::atomic<std::underlying_type_t<CacheUpdateFlags>> update_flags;
 
+    /**
+     * Record the cells that are going to be refined or coarsened, and remove
+     * the entries of these cells and of their neighbors from the data
+     * structures that are updated incrementally. This function is connected
+     * to the Triangulation::Signals::pre_refinement() signal.
+     */
+    void
+    prepare_incremental_update();
+
+    /**
+     * Complete the work started in prepare_incremental_update() by adding
+     * the entries of the new cells and of the neighbors of the changed cells,
+     * and mark all other data structures for update. If no incremental update
+     * is pending, simply mark all data structures for update. This function
+     * is connected to the Triangulation::Signals::any_change() signal.
+     */
+    void
+    update_after_triangulation_change();
+
+    /**
+     * The information recorded by prepare_incremental_update().
+     */
+    struct IncrementalUpdate
+    {
+      /**
+       * The data structures that are up to date and will be updated
+       * incrementally.
+       */
+      CacheUpdateFlags flags = update_nothing;
+
+      /**
+       * The active cells that are going to be refined.
+       */
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        refined_cells;
+
+      /**
+       * The cells whose children are going to be removed.
+       */
+      std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+        coarsened_cells;
+
+      /**
+       * The active cells that persist but whose entries in the vertex to
+       * cell map have been removed because they are adjacent to a changed
+       * cell.
+       */
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+        touched_cells;
+
+      /**
+       * The vertices whose entries in the vertex to cell map have changed.
+       */
+      std::vector<unsigned int> touched_vertices;
+
+      /**
+       * The vertices of the cells that are going to be removed by
+       * coarsening.
+       */
+      std::vector<unsigned int> coarsened_vertices;
+    };
+
+    IncrementalUpdate incremental_update;
+
     /**
      * A pointer to the Triangulation.
      */
@@ -302,6 +395,16 @@ namespace GridTools
                        cell_bounding_boxes_rtree;
     mutable std::mutex cell_bounding_boxes_rtree_mutex;
 
+    /**
+     * Store a BoundingVolumeHierarchy object, containing the bounding boxes
+     * of the cells of the triangulation.
+     */
+    mutable BoundingVolumeHierarchy<
+      spacedim,
+      typename Triangulation<dim, spacedim>::active_cell_iterator>
+                       cell_bounding_boxes_bvh;
+    mutable std::mutex cell_bounding_boxes_bvh_mutex;
+
     /**
      * Store an RTree object, containing the bounding boxes of the locally owned
      * cells of the triangulation.
@@ -332,6 +435,11 @@ namespace GridTools
      */
     boost::signals2::connection tria_change_signal;
 
+    /**
+     * Storage for the status of the triangulation pre-refinement signal.
+     */
+    boost::signals2::connection tria_pre_refinement_signal;
+
     /**
      * Storage for the status of the triangulation creation signal.
      */
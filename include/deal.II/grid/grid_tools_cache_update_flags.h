@@ -89,6 +89,11 @@ namespace GridTools
      */
     update_vertex_with_ghost_neighbors = 0x200,
 
+    /**
+     * Update the BoundingVolumeHierarchy of the cell bounding boxes.
+     */
+    update_cell_bounding_boxes_bvh = 0x400,
+
     /**
      * Update all objects.
      */
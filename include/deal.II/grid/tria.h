@@ -492,6 +492,59 @@ namespace internal
          const unsigned int n_attached_deserialize_variable,
          const MPI_Comm    &mpi_communicator);
 
+    /**
+     * Serialize data to file system using the indexed layout.
+     *
+     * In contrast to save(), which writes all fixed size data of a cell
+     * consecutively, this function writes the fixed size data in a
+     * field-major order: the buffers of each registered callback function
+     * (and the CellStatus information) are stored in separate, contiguous
+     * blocks ordered by the global cell index. The header of the
+     * <tt>_fixed.data</tt> file records the number of fields, their
+     * cumulative sizes per cell, and the byte offset of each block within
+     * the file. Variable size data is written in the same way as by save().
+     *
+     * This layout allows load_indexed() to read only a subset of the
+     * attached fields, and allows every process to read its range of cells
+     * of each field with a single contiguous read, independently of the
+     * number of processes that wrote the file.
+     *
+     * Data has to be previously packed with pack_data().
+     */
+    void
+    save_indexed(const unsigned int global_first_cell,
+                 const unsigned int global_num_cells,
+                 const std::string &file_basename,
+                 const MPI_Comm    &mpi_communicator) const;
+
+    /**
+     * Deserialize data from file system that has been written with
+     * save_indexed().
+     *
+     * Only the fixed size fields whose indices are listed in
+     * @p fixed_size_attachments are read, where the indices correspond to the
+     * order in which the fixed size callback functions were registered at the
+     * time the data was written. The loaded data is arranged in the same
+     * format as after load(), with the selected fields stored in the order
+     * given in @p fixed_size_attachments. Thus, the $i$th fixed size handle
+     * that is registered after loading refers to the field
+     * <tt>fixed_size_attachments[i]</tt>.
+     *
+     * If @p n_attached_deserialize_variable is nonzero, all variable size
+     * data is loaded as well.
+     *
+     * After loading, unpack_data() needs to be called to finally
+     * distribute data across the associated triangulation.
+     */
+    void
+    load_indexed(const unsigned int               global_first_cell,
+                 const unsigned int               global_num_cells,
+                 const unsigned int               local_num_cells,
+                 const std::string               &file_basename,
+                 const std::vector<unsigned int> &fixed_size_attachments,
+                 const unsigned int               n_attached_deserialize_variable,
+                 const MPI_Comm                  &mpi_communicator);
+
     /**
      * Clears all containers and associated data, and resets member
      * values to their default state.
@@ -533,6 +586,29 @@ namespace internal
     std::vector<int>  dest_sizes_variable;
     std::vector<char> src_data_variable;
     std::vector<char> dest_data_variable;
+
+  private:
+    /**
+     * Write the variable size data of the locally owned cells to the file
+     * system. Shared by save() and save_indexed().
+     */
+    void
+    save_variable_size_data(const unsigned int global_first_cell,
+                            const unsigned int global_num_cells,
+                            const std::string &file_basename,
+                            const MPI_Comm    &mpi_communicator) const;
+
+    /**
+     * Read the variable size data of the locally owned cells from the file
+     * system into dest_sizes_variable and dest_data_variable. Shared by
+     * load() and load_indexed().
+     */
+    void
+    load_variable_size_data(const unsigned int global_first_cell,
+                            const unsigned int global_num_cells,
+                            const unsigned int local_num_cells,
+                            const std::string &file_basename,
+                            const MPI_Comm    &mpi_communicator);
   };
 } // namespace internal
 
@@ -993,6 +1069,14 @@ namespace internal
  * use and does not allow access to the other one, until clear_user_data() has
  * been called.
  *
+ * The storage for user pointers and indices of lines, faces, and cells is
+ * only allocated upon the first write access to one of them, and released
+ * again by clear_user_data(). Triangulations that never use this feature
+ * therefore save the memory for one pointer per object. The allocation is
+ * thread-safe, so the user data of different objects may be set concurrently,
+ * e.g., inside WorkStream::run(), also when the storage has not been
+ * allocated yet.
+ *
  *
  * <h3>Describing curved geometries</h3>
  *
@@ -3866,15 +3950,19 @@ public:
 protected:
   /**
    * Save additional cell-attached data from files all starting with
-   * the base name given as last argument. The first
+   * the base name given as third argument. The first
    * arguments are used to determine the offsets where to write buffers to.
+   * If @p indexed_layout is set, the fixed size data is written field by
+   * field as described in
+   * internal::CellAttachedDataSerializer::save_indexed().
    *
    * Called by @ref save.
    */
   void
   save_attached_data(const unsigned int global_first_cell,
                      const unsigned int global_num_cells,
-                     const std::string &file_basename) const;
+                     const std::string &file_basename,
+                     const bool         indexed_layout = false) const;
 
   /**
    * Load additional cell-attached data files all starting with the
@@ -3892,6 +3980,21 @@ protected:
                      const unsigned int n_attached_deserialize_fixed,
                      const unsigned int n_attached_deserialize_variable);
 
+  /**
+   * Same as above, but for data that has been written with the indexed
+   * layout, i.e., by save_attached_data() with the last argument set to
+   * `true`. Only the fixed size fields listed in @p fixed_size_attachments
+   * are read from the file system, see
+   * internal::CellAttachedDataSerializer::load_indexed().
+   */
+  void
+  load_attached_data(const unsigned int               global_first_cell,
+                     const unsigned int               global_num_cells,
+                     const unsigned int               local_num_cells,
+                     const std::string               &file_basename,
+                     const std::vector<unsigned int> &fixed_size_attachments,
+                     const unsigned int n_attached_deserialize_variable);
+
   /**
    * A function to record the CellStatus of currently active cells.
    * This information is mandatory to transfer data between meshes
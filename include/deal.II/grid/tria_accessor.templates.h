@@ -32,6 +32,7 @@
 
 #include <cmath>
 #include <limits>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1821,7 +1822,10 @@ void
 TriaAccessor<structdim, dim, spacedim>::clear_user_pointer() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  this->objects().user_pointer(this->present_index) = nullptr;
+  // only write if there is something to clear, so that clearing does not
+  // allocate the storage for the user data
+  if (user_pointer() != nullptr)
+    this->objects().user_pointer(this->present_index) = nullptr;
 }
 
 
@@ -1831,7 +1835,11 @@ void *
 TriaAccessor<structdim, dim, spacedim>::user_pointer() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  return this->objects().user_pointer(this->present_index);
+  // objects() returns a non-const reference, but the non-const access
+  // function allocates the storage for the user data, which reads must not
+  // do
+  return const_cast<void *>(
+    std::as_const(this->objects()).user_pointer(this->present_index));
 }
 
 
@@ -1879,7 +1887,10 @@ void
 TriaAccessor<structdim, dim, spacedim>::clear_user_index() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  this->objects().user_index(this->present_index) = 0;
+  // only write if there is something to clear, so that clearing does not
+  // allocate the storage for the user data
+  if (user_index() != 0)
+    this->objects().user_index(this->present_index) = 0;
 }
 
 
@@ -1889,7 +1900,9 @@ unsigned int
 TriaAccessor<structdim, dim, spacedim>::user_index() const
 {
   Assert(this->used(), TriaAccessorExceptions::ExcCellNotUsed());
-  return this->objects().user_index(this->present_index);
+  // use the const access function, which does not allocate the storage for
+  // the user data, see user_pointer()
+  return std::as_const(this->objects()).user_index(this->present_index);
 }
 
 
@@ -708,6 +708,66 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Create the TriangulationDescription::Description objects of all
+     * @p n_partitions partitions of the serial triangulation @p tria and
+     * write them to a single binary file named @p filename. As in
+     * create_description_from_triangulation(), the partitioning is given by
+     * the subdomain ids (and, if the multigrid hierarchy is requested, by
+     * the level subdomain ids) of the cells of @p tria, which need to be
+     * less than @p n_partitions.
+     *
+     * The file starts with a small header followed by an index with the
+     * byte offset of every partition's description. This allows
+     * load_description() to seek directly to the data of a single
+     * partition, so that each process of a large parallel run only reads
+     * its own part of the mesh rather than the whole file. The expensive
+     * steps of setting up and partitioning the coarse mesh hence only need
+     * to be performed once, in a serial preprocessing run, and the file can
+     * then be used to create a parallel::fullydistributed::Triangulation
+     * with @p n_partitions processes:
+     * @code
+     * // preprocessing run
+     * Triangulation<dim> tria;
+     * GridIn<dim>(tria).read(file_name);
+     * GridTools::partition_triangulation(n_partitions, tria);
+     * TriangulationDescription::Utilities::write_descriptions(tria,
+     *                                                         n_partitions,
+     *                                                         "mesh.pft");
+     *
+     * // simulation run with n_partitions processes
+     * parallel::fullydistributed::Triangulation<dim> tria_pft(comm);
+     * tria_pft.create_triangulation(
+     *   TriangulationDescription::Utilities::load_description<dim, dim>(
+     *     "mesh.pft", comm));
+     * @endcode
+     *
+     * @note The data is written in the native binary representation of the
+     *   machine, i.e., files can not be exchanged between machines with
+     *   different endianness.
+     */
+    template <int dim, int spacedim>
+    void
+    write_descriptions(const dealii::Triangulation<dim, spacedim> &tria,
+                       const unsigned int                          n_partitions,
+                       const std::string                          &filename,
+                       const TriangulationDescription::Settings    settings =
+                         TriangulationDescription::Settings::default_setting);
+
+    /**
+     * Read the description of partition @p partition from a file written by
+     * write_descriptions(). Only the header, the index, and the data of the
+     * requested partition are read from the file. If @p partition is not
+     * given, the rank of the current process in @p comm is used. The
+     * communicator of the returned object is set to @p comm.
+     */
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    load_description(const std::string &filename,
+                     const MPI_Comm     comm,
+                     const unsigned int partition =
+                       numbers::invalid_unsigned_int);
+
   } // namespace Utilities
 
 
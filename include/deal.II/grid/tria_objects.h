@@ -20,7 +20,9 @@
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/lazy.h>
 
+#include <algorithm>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -255,7 +257,8 @@ namespace internal
 
       /**
        * Clear all user pointers or indices and reset their type, such that
-       * the next access may be either or.
+       * the next access may be either or. This also releases the memory of
+       * the user data.
        */
       void
       clear_user_data();
@@ -356,8 +359,14 @@ namespace internal
       /**
        * Pointer which is not used by the library but may be accessed and set
        * by the user to handle data local to a line/quad/etc.
+       *
+       * The vector is only allocated, with one entry per object, upon the
+       * first write access. Read access before that returns zero. Wrapping
+       * the vector in a Lazy object makes the allocation thread-safe, so
+       * that the user data of different objects may be written concurrently
+       * also when one of these writes is the first one.
        */
-      std::vector<UserData> user_data;
+      Lazy<std::vector<UserData>> user_data;
 
       /**
        * In order to avoid confusion between user pointers and indices, this
@@ -434,8 +443,10 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].p;
+      AssertIndexRange(i, n_objects());
+      return user_data.value_or_initialize([this]() {
+        return std::vector<UserData>(n_objects());
+      })[i].p;
     }
 
 
@@ -446,8 +457,8 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_pointer;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].p;
+      AssertIndexRange(i, n_objects());
+      return user_data.has_value() ? user_data.value()[i].p : nullptr;
     }
 
 
@@ -458,16 +469,19 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].i;
+      AssertIndexRange(i, n_objects());
+      return user_data.value_or_initialize([this]() {
+        return std::vector<UserData>(n_objects());
+      })[i].i;
     }
 
 
     inline void
     TriaObjects::clear_user_data(const unsigned int i)
     {
-      AssertIndexRange(i, user_data.size());
-      user_data[i].i = 0;
+      AssertIndexRange(i, n_objects());
+      if (user_data.has_value())
+        user_data.value()[i].i = 0;
     }
 
 
@@ -496,8 +510,8 @@ namespace internal
              ExcPointerIndexClash());
       user_data_type = data_index;
 
-      AssertIndexRange(i, user_data.size());
-      return user_data[i].i;
+      AssertIndexRange(i, n_objects());
+      return user_data.has_value() ? user_data.value()[i].i : 0;
     }
 
 
@@ -505,8 +519,9 @@ namespace internal
     TriaObjects::clear_user_data()
     {
       user_data_type = data_unknown;
-      for (auto &data : user_data)
-        data.p = nullptr;
+
+      // release the memory, it is allocated again upon the next write access
+      user_data.reset();
     }
 
 
@@ -539,7 +554,31 @@ namespace internal
       ar                                   &boundary_or_material_id;
       ar                                   &manifold_id;
       ar &next_free_single &next_free_pair &reverse_order_next_free_single;
-      ar &user_data                        &user_data_type;
+
+      // write the user data in the same format as if it had been allocated,
+      // and upon loading only allocate it if it contains nonzero entries
+      if (Archive::is_saving::value)
+        {
+          if (user_data.has_value())
+            ar &user_data.value();
+          else
+            {
+              std::vector<UserData> unallocated_user_data(n_objects());
+              ar                   &unallocated_user_data;
+            }
+        }
+      else
+        {
+          std::vector<UserData> loaded_user_data;
+          ar                   &loaded_user_data;
+          user_data.reset();
+          if (std::any_of(loaded_user_data.begin(),
+                          loaded_user_data.end(),
+                          [](const UserData &data) { return data.i != 0; }))
+            user_data.ensure_initialized(
+              [&loaded_user_data]() { return std::move(loaded_user_data); });
+        }
+      ar &user_data_type;
     }
 
 
@@ -0,0 +1,447 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_numerics_bounding_volume_hierarchy_h
+#define dealii_numerics_bounding_volume_hierarchy_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A bounding volume hierarchy (BVH), i.e., a tree of bounding boxes, that
+ * allows to find all boxes of a given set that contain a point in
+ * logarithmic time.
+ *
+ * In contrast to the RTree class, which is based on the generic
+ * implementation of the boost.geometry library, this class is tailored to
+ * point queries: each node of the tree stores the bounding boxes of its
+ * children in a structure-of-arrays layout with as many children as there
+ * are lanes in VectorizedArray<double> (but at least two), so that a point
+ * is tested against all children of a node with a few SIMD instructions.
+ * The nodes are stored contiguously in depth-first order, and the boxes of
+ * each leaf are stored next to each other.
+ *
+ * The tree is built top-down by sorting the boxes by their centers along
+ * the direction of largest extent and splitting them into groups of equal
+ * size, until each group contains at most a given number of boxes.
+ *
+ * Each box is associated with a value of type @p ValueType, e.g., the
+ * iterator of the cell the box belongs to. The query functions return the
+ * values of all boxes that contain the point, in the order in which the
+ * boxes were given.
+ *
+ * The class is used by GridTools::Cache::get_cell_bounding_boxes_bvh() to
+ * accelerate GridTools::find_active_cell_around_point().
+ */
+template <int spacedim, typename ValueType>
+class BoundingVolumeHierarchy
+{
+public:
+  /**
+   * Number of children of each node of the tree.
+   */
+  static constexpr unsigned int n_children =
+    std::max<unsigned int>(2, VectorizedArray<double>::size());
+
+  /**
+   * Default constructor. Creates an empty hierarchy.
+   */
+  BoundingVolumeHierarchy() = default;
+
+  /**
+   * Constructor. Build the hierarchy for the given boxes and values, see
+   * reinit().
+   */
+  BoundingVolumeHierarchy(
+    const std::vector<std::pair<BoundingBox<spacedim>, ValueType>> &boxes,
+    const unsigned int max_leaf_size = 8);
+
+  /**
+   * Build the hierarchy for the given boxes and values. The leaves of the
+   * tree contain at most @p max_leaf_size boxes.
+   */
+  void
+  reinit(const std::vector<std::pair<BoundingBox<spacedim>, ValueType>> &boxes,
+         const unsigned int max_leaf_size = 8);
+
+  /**
+   * Return whether the hierarchy contains no boxes.
+   */
+  bool
+  empty() const;
+
+  /**
+   * Return the number of boxes in the hierarchy.
+   */
+  std::size_t
+  size() const;
+
+  /**
+   * Return the values of all boxes that contain the point @p p, with the
+   * boxes enlarged by the absolute @p tolerance in each direction. The
+   * values are returned in the order in which the boxes were given to
+   * reinit().
+   */
+  std::vector<ValueType>
+  query(const Point<spacedim> &p, const double tolerance = 0.) const;
+
+  /**
+   * Like the previous function, but for many points at once. The i-th
+   * entry of the result contains the values of the boxes that contain the
+   * i-th point. The points are processed in parallel.
+   */
+  std::vector<std::vector<ValueType>>
+  query(const std::vector<Point<spacedim>> &points,
+        const double                        tolerance = 0.) const;
+
+  /**
+   * Return an estimate for the memory consumption, in bytes, of this
+   * object, not counting memory allocated by the values themselves.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * A node of the tree. The bounds of the children are stored in the arrays
+   * @p lower and @p upper. A child with index @p c is a leaf if
+   * <code>end[c]</code> is valid, in which case it contains the boxes with
+   * indices in the range <code>[begin[c], end[c])</code> of the array
+   * #boxes. Otherwise, <code>begin[c]</code> is the index of the child node
+   * in the array #nodes. Unused children have empty bounds that no point is
+   * inside of.
+   */
+  struct Node
+  {
+    std::array<std::array<double, n_children>, spacedim> lower;
+    std::array<std::array<double, n_children>, spacedim> upper;
+    std::array<unsigned int, n_children>                 begin;
+    std::array<unsigned int, n_children>                 end;
+  };
+
+  /**
+   * Build the subtree for the boxes in the range [begin, end) of the array
+   * #boxes and return the index of its root node.
+   */
+  unsigned int
+  build(const unsigned int begin,
+        const unsigned int end,
+        const unsigned int max_leaf_size);
+
+  /**
+   * Append the indices (into the array #values) of the boxes containing the
+   * point @p p to @p indices, in arbitrary order.
+   */
+  void
+  collect(const Point<spacedim>                           &p,
+          const double                                     tolerance,
+          boost::container::small_vector<unsigned int, 16> &indices) const;
+
+  /**
+   * The nodes of the tree, in depth-first order. The root is the first
+   * node.
+   */
+  std::vector<Node> nodes;
+
+  /**
+   * The boxes, sorted so that the boxes of each leaf are contiguous,
+   * together with their index in the array #values.
+   */
+  std::vector<std::pair<BoundingBox<spacedim>, unsigned int>> boxes;
+
+  /**
+   * The values associated with the boxes, in the order of the input.
+   */
+  std::vector<ValueType> values;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int spacedim, typename ValueType>
+BoundingVolumeHierarchy<spacedim, ValueType>::BoundingVolumeHierarchy(
+  const std::vector<std::pair<BoundingBox<spacedim>, ValueType>> &boxes,
+  const unsigned int                                              max_leaf_size)
+{
+  reinit(boxes, max_leaf_size);
+}
+
+
+
+template <int spacedim, typename ValueType>
+void
+BoundingVolumeHierarchy<spacedim, ValueType>::reinit(
+  const std::vector<std::pair<BoundingBox<spacedim>, ValueType>> &input,
+  const unsigned int                                              max_leaf_size)
+{
+  Assert(max_leaf_size > 0, ExcMessage("The leaf size must be positive."));
+
+  nodes.clear();
+  boxes.clear();
+  values.clear();
+
+  boxes.reserve(input.size());
+  values.reserve(input.size());
+  for (unsigned int i = 0; i < input.size(); ++i)
+    {
+      boxes.emplace_back(input[i].first, i);
+      values.push_back(input[i].second);
+    }
+
+  if (boxes.empty() == false)
+    build(0, boxes.size(), max_leaf_size);
+}
+
+
+
+template <int spacedim, typename ValueType>
+unsigned int
+BoundingVolumeHierarchy<spacedim, ValueType>::build(
+  const unsigned int begin,
+  const unsigned int end,
+  const unsigned int max_leaf_size)
+{
+  // sort the boxes by their centers along the direction in which the
+  // centers are spread most
+  Point<spacedim> lower = boxes[begin].first.center();
+  Point<spacedim> upper = lower;
+  for (unsigned int i = begin; i < end; ++i)
+    {
+      const Point<spacedim> center = boxes[i].first.center();
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          lower[d] = std::min(lower[d], center[d]);
+          upper[d] = std::max(upper[d], center[d]);
+        }
+    }
+  unsigned int direction = 0;
+  for (unsigned int d = 1; d < spacedim; ++d)
+    if (upper[d] - lower[d] > upper[direction] - lower[direction])
+      direction = d;
+
+  std::sort(boxes.begin() + begin,
+            boxes.begin() + end,
+            [direction](const auto &a, const auto &b) {
+              return a.first.center()[direction] <
+                     b.first.center()[direction];
+            });
+
+  // then split them into groups of equal size, one per child
+  const unsigned int node_index = nodes.size();
+  nodes.emplace_back();
+  for (unsigned int c = 0; c < n_children; ++c)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      {
+        nodes[node_index].lower[d][c] = std::numeric_limits<double>::max();
+        nodes[node_index].upper[d][c] = std::numeric_limits<double>::lowest();
+      }
+
+  const unsigned int n_boxes = end - begin;
+  for (unsigned int c = 0; c < n_children; ++c)
+    {
+      const unsigned int child_begin =
+        begin + static_cast<std::uint64_t>(n_boxes) * c / n_children;
+      const unsigned int child_end =
+        begin + static_cast<std::uint64_t>(n_boxes) * (c + 1) / n_children;
+
+      nodes[node_index].begin[c] = child_begin;
+      nodes[node_index].end[c]   = child_end;
+      if (child_begin == child_end)
+        continue;
+
+      BoundingBox<spacedim> child_box = boxes[child_begin].first;
+      for (unsigned int i = child_begin + 1; i < child_end; ++i)
+        child_box.merge_with(boxes[i].first);
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          nodes[node_index].lower[d][c] = child_box.lower_bound(d);
+          nodes[node_index].upper[d][c] = child_box.upper_bound(d);
+        }
+
+      // note that the array of nodes may be reallocated in the recursive
+      // call, so only access it through the index afterwards
+      if (child_end - child_begin > max_leaf_size)
+        {
+          const unsigned int child_node =
+            build(child_begin, child_end, max_leaf_size);
+          nodes[node_index].begin[c] = child_node;
+          nodes[node_index].end[c]   = numbers::invalid_unsigned_int;
+        }
+    }
+
+  return node_index;
+}
+
+
+
+template <int spacedim, typename ValueType>
+inline bool
+BoundingVolumeHierarchy<spacedim, ValueType>::empty() const
+{
+  return values.empty();
+}
+
+
+
+template <int spacedim, typename ValueType>
+inline std::size_t
+BoundingVolumeHierarchy<spacedim, ValueType>::size() const
+{
+  return values.size();
+}
+
+
+
+template <int spacedim, typename ValueType>
+void
+BoundingVolumeHierarchy<spacedim, ValueType>::collect(
+  const Point<spacedim>                            &p,
+  const double                                      tolerance,
+  boost::container::small_vector<unsigned int, 16> &indices) const
+{
+  if (nodes.empty())
+    return;
+
+  constexpr unsigned int n_lanes = VectorizedArray<double>::size();
+  static_assert(n_children % n_lanes == 0,
+                "The number of children must be a multiple of the number of "
+                "SIMD lanes.");
+
+  // the nodes still to be visited. Since the tree is balanced, this stack
+  // holds at most (n_children-1) nodes per level of the tree, and its
+  // storage on the function stack suffices for all reasonable trees.
+  boost::container::small_vector<unsigned int, 64> stack(1, 0);
+  while (stack.empty() == false)
+    {
+      const Node &node = nodes[stack.back()];
+      stack.pop_back();
+
+      for (unsigned int c0 = 0; c0 < n_children; c0 += n_lanes)
+        {
+          // test the point against n_lanes children at once
+          VectorizedArray<double> inside = 1.;
+          for (unsigned int d = 0; d < spacedim; ++d)
+            {
+              VectorizedArray<double> lower, upper;
+              lower.load(node.lower[d].data() + c0);
+              upper.load(node.upper[d].data() + c0);
+              const VectorizedArray<double> coordinate = p[d];
+              inside =
+                compare_and_apply_mask<SIMDComparison::less_than_or_equal>(
+                  lower - tolerance,
+                  coordinate,
+                  inside,
+                  VectorizedArray<double>(0.));
+              inside =
+                compare_and_apply_mask<SIMDComparison::less_than_or_equal>(
+                  coordinate,
+                  upper + tolerance,
+                  inside,
+                  VectorizedArray<double>(0.));
+            }
+
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            if (inside[v] != 0.)
+              {
+                const unsigned int c = c0 + v;
+                if (node.end[c] == numbers::invalid_unsigned_int)
+                  stack.push_back(node.begin[c]);
+                else
+                  for (unsigned int i = node.begin[c]; i < node.end[c]; ++i)
+                    {
+                      bool box_inside = true;
+                      for (unsigned int d = 0; d < spacedim; ++d)
+                        if (p[d] < boxes[i].first.lower_bound(d) - tolerance ||
+                            p[d] > boxes[i].first.upper_bound(d) + tolerance)
+                          box_inside = false;
+                      if (box_inside)
+                        indices.push_back(boxes[i].second);
+                    }
+              }
+        }
+    }
+}
+
+
+
+template <int spacedim, typename ValueType>
+std::vector<ValueType>
+BoundingVolumeHierarchy<spacedim, ValueType>::query(
+  const Point<spacedim> &p,
+  const double           tolerance) const
+{
+  boost::container::small_vector<unsigned int, 16> indices;
+  collect(p, tolerance, indices);
+  std::sort(indices.begin(), indices.end());
+
+  std::vector<ValueType> result;
+  result.reserve(indices.size());
+  for (const unsigned int i : indices)
+    result.push_back(values[i]);
+  return result;
+}
+
+
+
+template <int spacedim, typename ValueType>
+std::vector<std::vector<ValueType>>
+BoundingVolumeHierarchy<spacedim, ValueType>::query(
+  const std::vector<Point<spacedim>> &points,
+  const double                        tolerance) const
+{
+  std::vector<std::vector<ValueType>> result(points.size());
+  parallel::apply_to_subranges(
+    0u,
+    static_cast<unsigned int>(points.size()),
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int i = begin; i < end; ++i)
+        result[i] = query(points[i], tolerance);
+    },
+    64);
+  return result;
+}
+
+
+
+template <int spacedim, typename ValueType>
+std::size_t
+BoundingVolumeHierarchy<spacedim, ValueType>::memory_consumption() const
+{
+  return sizeof(*this) + nodes.capacity() * sizeof(Node) +
+         boxes.capacity() * sizeof(typename decltype(boxes)::value_type) +
+         values.capacity() * sizeof(ValueType);
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -20,6 +20,7 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/function.h>
+#include <deal.II/base/memory_space.h>
 
 #include <deal.II/fe/component_mask.h>
 
@@ -36,14 +37,26 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 class DoFHandler;
 template <int, int>
 class Mapping;
+template <int dim, typename number, typename VectorizedArrayType>
+class MatrixFree;
 template <int>
 class Quadrature;
+template <typename Number, std::size_t width>
+class VectorizedArray;
 
 namespace hp
 {
   template <int>
   class QCollection;
 }
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
 #endif
 
 
@@ -510,6 +523,49 @@ public:
     const types::material_id  material_id  = numbers::invalid_material_id,
     const Strategy            strategy     = cell_diameter_over_24);
 
+  /**
+   * Variant of the functions above that computes the jumps of the normal
+   * gradients with the face loops of @p matrix_free instead of FEFaceValues
+   * and FESubfaceValues. The gradients on both sides of a batch of faces are
+   * evaluated with FEFaceEvaluation by sum factorization, which is much
+   * cheaper than the FEValues path for higher polynomial degrees. Faces with
+   * hanging nodes are visited by MatrixFree as pairs of a fine cell and a
+   * subface of the coarser neighbor, so their contributions are computed in
+   * the same way as those of regular faces. The face integrals are then
+   * collected into @p error, which is indexed by the active cell index of the
+   * triangulation, just as in the other functions of this class.
+   *
+   * The solution is taken from the DoFHandler with index @p dof_no, and the
+   * face quadrature is the one with index @p quad_no in @p matrix_free. The
+   * MatrixFree object needs to be set up with at least update_gradients,
+   * update_JxW_values, and update_normal_vectors in
+   * MatrixFree::AdditionalData::mapping_update_flags_inner_faces. The face
+   * loop runs on several threads if @p matrix_free was set up with a
+   * task-parallel scheme. On distributed triangulations, every face is only
+   * visited by one of the processes that own an adjacent cell; contributions
+   * to cells owned by other processes are sent to their owners. The entries
+   * of @p error that do not belong to locally owned cells are zero.
+   *
+   * All vector components are used, there is no coefficient, and the
+   * boundary faces do not contribute, i.e., the function computes the same
+   * values as the other functions of this class with an empty map of
+   * Neumann boundary values and a quadrature formula that matches the one
+   * of @p matrix_free.
+   *
+   * @note Only implemented for `dim == spacedim`, and instantiated for
+   * MatrixFree objects over double and float.
+   */
+  template <typename Number>
+  static void
+  estimate(
+    const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+    const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+                      &solution,
+    Vector<float>     &error,
+    const unsigned int dof_no   = 0,
+    const unsigned int quad_no  = 0,
+    const Strategy     strategy = cell_diameter_over_24);
+
   /**
    * Exception
    */
@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/numbers.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/quadrature_lib.h>
@@ -32,6 +33,7 @@
 #include <deal.II/fe/fe_update_flags.h>
 #include <deal.II/fe/fe_values.h>
 
+#include <deal.II/grid/cell_id.h>
 #include <deal.II/grid/tria_iterator.h>
 
 #include <deal.II/hp/fe_values.h>
@@ -47,8 +49,13 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
 #include <deal.II/numerics/error_estimator.h>
 
+#include <boost/serialization/utility.hpp>
+
 #include <algorithm>
 #include <cmath>
 #include <functional>
@@ -1399,6 +1406,165 @@ KellyErrorEstimator<dim, spacedim>::estimate(
            strategy);
 }
 
+
+
+template <int dim, int spacedim>
+template <typename Number>
+void
+KellyErrorEstimator<dim, spacedim>::estimate(
+  const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+  const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+                    &solution,
+  Vector<float>     &error,
+  const unsigned int dof_no,
+  const unsigned int quad_no,
+  const Strategy     strategy)
+{
+  static_assert(dim == spacedim,
+                "The MatrixFree variant of the Kelly error estimator is only "
+                "implemented for dim == spacedim.");
+  using VectorType          = LinearAlgebra::distributed::Vector<Number>;
+  using VectorizedArrayType = VectorizedArray<Number>;
+
+  Assert(matrix_free.get_mg_level() == numbers::invalid_unsigned_int,
+         ExcNotImplemented());
+
+  const DoFHandler<dim, spacedim> &dof_handler =
+    matrix_free.get_dof_handler(dof_no);
+  const Triangulation<dim, spacedim> &triangulation =
+    dof_handler.get_triangulation();
+  const unsigned int n_components =
+    dof_handler.get_fe_collection().n_components();
+
+  // First compute the integral of the squared jump of the normal gradient
+  // on every inner face batch. Each face batch only writes into its own
+  // slot, so the face loop may run on several threads.
+  AlignedVector<VectorizedArrayType> face_integrals(
+    matrix_free.n_inner_face_batches());
+
+  int dummy = 0;
+  matrix_free.template loop<int, VectorType>(
+    [](const MatrixFree<dim, Number, VectorizedArrayType> &,
+       int &,
+       const VectorType &,
+       const std::pair<unsigned int, unsigned int> &) {},
+    [&](const MatrixFree<dim, Number, VectorizedArrayType> &data,
+        int &,
+        const VectorType                            &src,
+        const std::pair<unsigned int, unsigned int> &face_range) {
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          FEFaceEvaluation<dim, -1, 0, 1, Number> phi_m(
+            data, face_range, true, dof_no, quad_no, c);
+          FEFaceEvaluation<dim, -1, 0, 1, Number> phi_p(
+            data, face_range, false, dof_no, quad_no, c);
+
+          for (unsigned int face = face_range.first; face < face_range.second;
+               ++face)
+            {
+              phi_m.reinit(face);
+              phi_p.reinit(face);
+              phi_m.gather_evaluate(src, EvaluationFlags::gradients);
+              phi_p.gather_evaluate(src, EvaluationFlags::gradients);
+
+              VectorizedArrayType integral = Number();
+              for (const unsigned int q : phi_m.quadrature_point_indices())
+                {
+                  // both sides use the normal vector of the interior cell
+                  const VectorizedArrayType jump =
+                    phi_m.get_normal_derivative(q) -
+                    phi_p.get_normal_derivative(q);
+                  integral += jump * jump * phi_m.JxW(q);
+                }
+
+              if (c == 0)
+                face_integrals[face] = integral;
+              else
+                face_integrals[face] += integral;
+            }
+        }
+    },
+    [](const MatrixFree<dim, Number, VectorizedArrayType> &,
+       int &,
+       const VectorType &,
+       const std::pair<unsigned int, unsigned int> &) {},
+    dummy,
+    solution,
+    false,
+    MatrixFree<dim, Number, VectorizedArrayType>::DataAccessOnFaces::none,
+    MatrixFree<dim, Number, VectorizedArrayType>::DataAccessOnFaces::
+      gradients);
+
+  // Then add the face integrals to the two adjacent cells. Faces with
+  // hanging nodes are stored as a pair of the fine cell and a subface of the
+  // coarse cell, so the contributions of all subfaces of a face add up on
+  // the coarse cell. Contributions to cells owned by another process are
+  // collected and sent to that process below.
+  error.reinit(triangulation.n_active_cells());
+  std::map<unsigned int, std::vector<std::pair<CellId, double>>>
+    remote_contributions;
+
+  for (unsigned int face = 0; face < matrix_free.n_inner_face_batches(); ++face)
+    for (unsigned int v = 0;
+         v < matrix_free.n_active_entries_per_face_batch(face);
+         ++v)
+      {
+        const auto interior =
+          matrix_free.get_face_iterator(face, v, true, dof_no);
+        const auto exterior =
+          matrix_free.get_face_iterator(face, v, false, dof_no);
+
+        double contribution = face_integrals[face][v];
+        if (strategy == face_diameter_over_twice_max_degree)
+          {
+            // the face of the finer cell is the smaller one, which is the
+            // subface the integral was computed on
+            const double face_diameter =
+              std::min(interior.first->face(interior.second)->diameter(),
+                       exterior.first->face(exterior.second)->diameter());
+            const double max_degree =
+              std::max(interior.first->get_fe().degree,
+                       exterior.first->get_fe().degree);
+            contribution *= face_diameter / max_degree / 2.0;
+          }
+
+        for (const auto &cell : {interior.first, exterior.first})
+          if (cell->is_locally_owned())
+            error(cell->active_cell_index()) += contribution;
+          else
+            remote_contributions[cell->subdomain_id()].emplace_back(
+              cell->id(), contribution);
+      }
+
+  if (const auto *parallel_triangulation =
+        dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+          &triangulation))
+    {
+      const auto received_contributions = Utilities::MPI::some_to_some(
+        parallel_triangulation->get_communicator(), remote_contributions);
+      for (const auto &[rank, contributions] : received_contributions)
+        {
+          (void)rank;
+          for (const auto &[cell_id, contribution] : contributions)
+            error(triangulation.create_cell_iterator(cell_id)
+                    ->active_cell_index()) += contribution;
+        }
+    }
+  else
+    Assert(remote_contributions.empty(), ExcInternalError());
+
+  // Finally scale with the cell factor of the strategy and take the square
+  // root
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        const unsigned int index = cell->active_cell_index();
+        error(index) =
+          std::sqrt(error(index) * internal::cell_factor<dim, spacedim>(
+                                     cell, 0, dof_handler, strategy));
+      }
+}
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -410,6 +410,11 @@ public:
    * input vectors. Also, the sizes of the output vectors are assumed to be of
    * the right size (@p n_dofs_refined). Otherwise an assertion will be
    * thrown.
+   *
+   * The values on the cells are computed on several threads, for all vectors
+   * at once. Transferring many vectors with a single call of this function
+   * (and of prepare_for_coarsening_and_refinement()) is therefore
+   * considerably cheaper than transferring them one at a time.
    */
   void
   interpolate(const std::vector<VectorType> &all_in,
@@ -564,6 +569,16 @@ private:
    */
   std::vector<std::vector<Vector<typename VectorType::value_type>>>
     dof_values_on_cell;
+
+  /**
+   * Interpolate the vectors pointed to by @p all_in to the vectors pointed
+   * to by @p all_out on all cells stored in @p cell_map. The values are
+   * computed on several threads, and then written into the output vectors
+   * in the order of the cells in @p cell_map.
+   */
+  void
+  interpolate_on_cells(const std::vector<const VectorType *> &all_in,
+                       const std::vector<VectorType *>       &all_out) const;
 };
 
 
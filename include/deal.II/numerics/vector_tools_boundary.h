@@ -172,6 +172,12 @@ namespace VectorTools
    *   "nodal" finite element spaces (such as FE_Q, but not
    *   FE_Q_Hierarchical), whereas the projection is always possible.
    *
+   * @note In more than one space dimension, the boundary functions are
+   *   evaluated on several cells concurrently using WorkStream, so they
+   *   must support concurrent calls to their <code>const</code> member
+   *   functions. The values are entered into @p boundary_values in the
+   *   same order as in a sequential loop over the cells.
+   *
    * See the general documentation of this namespace for more information.
    */
   template <int dim, int spacedim, typename number>
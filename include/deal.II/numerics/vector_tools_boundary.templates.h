@@ -18,6 +18,7 @@
 
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_tools.h>
 
@@ -27,6 +28,8 @@
 #include <deal.II/fe/fe_raviart_thomas.h>
 #include <deal.II/fe/fe_system.h>
 
+#include <deal.II/grid/filtered_iterator.h>
+
 #include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/q_collection.h>
 
@@ -50,6 +53,40 @@ namespace VectorTools
 
   namespace internal
   {
+    // Per-thread scratch object for the loop over boundary faces in
+    // do_interpolate_boundary_values() below: the hp::FEFaceValues object
+    // that maps the support points to the real faces, and the arrays to
+    // store dof indices and values of the boundary function on a face.
+    // There are two arrays for scalar and vector functions to use the more
+    // efficient one respectively.
+    template <int dim, int spacedim, typename number>
+    struct InterpolateBoundaryValuesScratchData
+    {
+      InterpolateBoundaryValuesScratchData(
+        const hp::MappingCollection<dim, spacedim>  &mapping_collection,
+        const hp::FECollection<dim, spacedim>       &fe_collection,
+        const std::vector<hp::QCollection<dim - 1>> &q_collection)
+        : x_fe_values(mapping_collection,
+                      fe_collection,
+                      q_collection,
+                      update_quadrature_points)
+      {
+        face_dofs.reserve(fe_collection.max_dofs_per_face());
+        dof_values_scalar.reserve(fe_collection.max_dofs_per_face());
+        dof_values_system.reserve(fe_collection.max_dofs_per_face());
+      }
+
+      InterpolateBoundaryValuesScratchData(
+        const InterpolateBoundaryValuesScratchData &scratch) = default;
+
+      hp::FEFaceValues<dim, spacedim>      x_fe_values;
+      std::vector<types::global_dof_index> face_dofs;
+      std::vector<number>                  dof_values_scalar;
+      std::vector<Vector<number>>          dof_values_system;
+    };
+
+
+
     template <int dim,
               int spacedim,
               typename number,
@@ -147,20 +184,6 @@ namespace VectorTools
         {
           const bool fe_is_system = (n_components != 1);
 
-          // field to store the indices
-          std::vector<types::global_dof_index> face_dofs;
-          face_dofs.reserve(dof.get_fe_collection().max_dofs_per_face());
-
-          // array to store the values of the boundary function at the boundary
-          // points. have two arrays for scalar and vector functions to use the
-          // more efficient one respectively
-          std::vector<number>         dof_values_scalar;
-          std::vector<Vector<number>> dof_values_system;
-          dof_values_scalar.reserve(
-            dof.get_fe_collection().max_dofs_per_face());
-          dof_values_system.reserve(
-            dof.get_fe_collection().max_dofs_per_face());
-
           // before we start with the loop over all cells create an hp::FEValues
           // object that holds the interpolation points of all finite elements
           // that may ever be in use
@@ -221,169 +244,204 @@ namespace VectorTools
                   }
               }
           // now that we have a q_collection object with all the right
-          // quadrature points, create an hp::FEFaceValues object that we can
-          // use to evaluate the boundary values at
+          // quadrature points, create the scratch object with an
+          // hp::FEFaceValues object that we can use to evaluate the boundary
+          // values at. every thread works on its own copy of it
           const auto mapping_collection =
             dealii::hp::MappingCollection<dim, spacedim>(mapping);
-          dealii::hp::FEFaceValues<dim, spacedim> x_fe_values(
-            mapping_collection,
-            finite_elements,
-            q_collection,
-            update_quadrature_points);
-
-          for (const auto &cell : dof.active_cell_iterators())
-            if (!cell->is_artificial())
-              for (const unsigned int face_no : cell->face_indices())
-                {
-                  const FiniteElement<dim, spacedim> &fe = cell->get_fe();
-
-                  // we can presently deal only with primitive elements for
-                  // boundary values. this does not preclude us using
-                  // non-primitive elements in components that we aren't
-                  // interested in, however. make sure that all shape functions
-                  // that are non-zero for the components we are interested in,
-                  // are in fact primitive
-                  for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
-                    {
-                      const ComponentMask &nonzero_component_array =
-                        fe.get_nonzero_components(i);
-                      for (unsigned int c = 0; c < n_components; ++c)
-                        if ((nonzero_component_array[c] == true) &&
-                            (component_mask[c] == true))
-                          Assert(
-                            fe.is_primitive(i),
-                            ExcMessage(
-                              "This function can only deal with requested boundary "
-                              "values that correspond to primitive (scalar) base "
-                              "elements. You may want to look up in the deal.II "
-                              "glossary what the term 'primitive' means."
-                              "\n\n"
-                              "There are alternative boundary value interpolation "
-                              "functions in namespace 'VectorTools' that you can "
-                              "use for non-primitive finite elements."));
-                    }
+          using ScratchData =
+            InterpolateBoundaryValuesScratchData<dim, spacedim, number>;
+          using CopyData =
+            std::vector<std::pair<types::global_dof_index, number>>;
+          const ScratchData sample_scratch(mapping_collection,
+                                           finite_elements,
+                                           q_collection);
+
+          // evaluating the boundary function is the expensive part of this
+          // function and independent between cells, so loop over all cells
+          // at the boundary in parallel. the copier enters the values into
+          // the map in the order of the cells, so that dofs shared between
+          // faces get the same value as in a sequential loop
+          const auto worker = [&](const auto  &cell,
+                                  ScratchData &scratch,
+                                  CopyData    &copy_data) {
+            copy_data.clear();
+
+            auto &face_dofs         = scratch.face_dofs;
+            auto &dof_values_scalar = scratch.dof_values_scalar;
+            auto &dof_values_system = scratch.dof_values_system;
+
+            for (const unsigned int face_no : cell->face_indices())
+              {
+                const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+
+                // we can presently deal only with primitive elements for
+                // boundary values. this does not preclude us using
+                // non-primitive elements in components that we aren't
+                // interested in, however. make sure that all shape functions
+                // that are non-zero for the components we are interested in,
+                // are in fact primitive
+                for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+                  {
+                    const ComponentMask &nonzero_component_array =
+                      fe.get_nonzero_components(i);
+                    for (unsigned int c = 0; c < n_components; ++c)
+                      if ((nonzero_component_array[c] == true) &&
+                          (component_mask[c] == true))
+                        Assert(
+                          fe.is_primitive(i),
+                          ExcMessage(
+                            "This function can only deal with requested boundary "
+                            "values that correspond to primitive (scalar) base "
+                            "elements. You may want to look up in the deal.II "
+                            "glossary what the term 'primitive' means."
+                            "\n\n"
+                            "There are alternative boundary value interpolation "
+                            "functions in namespace 'VectorTools' that you can "
+                            "use for non-primitive finite elements."));
+                  }
 
-                  const typename DoFHandler<dim, spacedim>::face_iterator face =
-                    cell->face(face_no);
-                  const types::boundary_id boundary_component =
-                    face->boundary_id();
-
-                  // see if this face is part of the boundaries for which we are
-                  // supposed to do something, and also see if the finite
-                  // element in use here has DoFs on the face at all
-                  if ((function_map.find(boundary_component) !=
-                       function_map.end()) &&
-                      (fe.n_dofs_per_face(face_no) > 0))
-                    {
-                      // face is of the right component
-                      x_fe_values.reinit(cell, face_no);
-                      const dealii::FEFaceValues<dim, spacedim> &fe_values =
-                        x_fe_values.get_present_fe_values();
-
-                      // get indices, physical location and boundary values of
-                      // dofs on this face
-                      face_dofs.resize(fe.n_dofs_per_face(face_no));
-                      face->get_dof_indices(face_dofs, cell->active_fe_index());
-                      std::vector<Point<spacedim>> dof_locations =
-                        fe_values.get_quadrature_points();
-                      dof_locations.resize(fe.n_dofs_per_face(face_no));
-
-                      if (fe_is_system)
-                        {
-                          dof_values_system.resize(fe.n_dofs_per_face(face_no),
-                                                   Vector<number>(
-                                                     fe.n_components()));
-
-                          function_map.find(boundary_component)
-                            ->second->vector_value_list(dof_locations,
-                                                        dof_values_system);
-
-                          // enter those dofs into the list that match the
-                          // component signature. avoid the usual complication
-                          // that we can't just use *_system_to_component_index
-                          // for non-primitive FEs
-                          for (unsigned int i = 0; i < face_dofs.size(); ++i)
-                            {
-                              unsigned int component;
-                              if (fe.is_primitive())
-                                component =
-                                  fe.face_system_to_component_index(i, face_no)
-                                    .first;
-                              else
-                                {
-                                  // non-primitive case. make sure that this
-                                  // particular shape function _is_ primitive,
-                                  // and get at it's component. use usual trick
-                                  // to transfer face dof index to cell dof
-                                  // index
-                                  const unsigned int cell_i =
-                                    (dim == 1 ?
-                                       i :
-                                       (dim == 2 ?
-                                          (i < 2 * fe.n_dofs_per_vertex() ?
-                                             i :
-                                             i + 2 * fe.n_dofs_per_vertex()) :
-                                          (dim == 3 ?
-                                             (i < 4 * fe.n_dofs_per_vertex() ?
-                                                i :
-                                                (i < 4 * fe.n_dofs_per_vertex() +
-                                                       4 *
-                                                         fe.n_dofs_per_line() ?
-                                                   i +
-                                                     4 *
-                                                       fe.n_dofs_per_vertex() :
-                                                   i +
+                const typename DoFHandler<dim, spacedim>::face_iterator face =
+                  cell->face(face_no);
+                const types::boundary_id boundary_component =
+                  face->boundary_id();
+
+                // see if this face is part of the boundaries for which we are
+                // supposed to do something, and also see if the finite
+                // element in use here has DoFs on the face at all
+                if ((function_map.find(boundary_component) !=
+                     function_map.end()) &&
+                    (fe.n_dofs_per_face(face_no) > 0))
+                  {
+                    // face is of the right component
+                    scratch.x_fe_values.reinit(cell, face_no);
+                    const dealii::FEFaceValues<dim, spacedim> &fe_values =
+                      scratch.x_fe_values.get_present_fe_values();
+
+                    // get indices, physical location and boundary values of
+                    // dofs on this face
+                    face_dofs.resize(fe.n_dofs_per_face(face_no));
+                    face->get_dof_indices(face_dofs, cell->active_fe_index());
+                    std::vector<Point<spacedim>> dof_locations =
+                      fe_values.get_quadrature_points();
+                    dof_locations.resize(fe.n_dofs_per_face(face_no));
+
+                    if (fe_is_system)
+                      {
+                        dof_values_system.resize(fe.n_dofs_per_face(face_no),
+                                                 Vector<number>(
+                                                   fe.n_components()));
+
+                        function_map.find(boundary_component)
+                          ->second->vector_value_list(dof_locations,
+                                                      dof_values_system);
+
+                        // enter those dofs into the list that match the
+                        // component signature. avoid the usual complication
+                        // that we can't just use *_system_to_component_index
+                        // for non-primitive FEs
+                        for (unsigned int i = 0; i < face_dofs.size(); ++i)
+                          {
+                            unsigned int component;
+                            if (fe.is_primitive())
+                              component =
+                                fe.face_system_to_component_index(i, face_no)
+                                  .first;
+                            else
+                              {
+                                // non-primitive case. make sure that this
+                                // particular shape function _is_ primitive,
+                                // and get at it's component. use usual trick
+                                // to transfer face dof index to cell dof
+                                // index
+                                const unsigned int cell_i =
+                                  (dim == 1 ?
+                                     i :
+                                     (dim == 2 ?
+                                        (i < 2 * fe.n_dofs_per_vertex() ?
+                                           i :
+                                           i + 2 * fe.n_dofs_per_vertex()) :
+                                        (dim == 3 ?
+                                           (i < 4 * fe.n_dofs_per_vertex() ?
+                                              i :
+                                              (i < 4 * fe.n_dofs_per_vertex() +
                                                      4 *
-                                                       fe.n_dofs_per_vertex() +
-                                                     8 *
-                                                       fe.n_dofs_per_line())) :
-                                             numbers::invalid_unsigned_int)));
-                                  Assert(cell_i < fe.n_dofs_per_cell(),
-                                         ExcInternalError());
-
-                                  // make sure that if this is not a primitive
-                                  // shape function, then all the corresponding
-                                  // components in the mask are not set
-                                  if (!fe.is_primitive(cell_i))
-                                    for (unsigned int c = 0; c < n_components;
-                                         ++c)
-                                      if (fe.get_nonzero_components(cell_i)[c])
-                                        Assert(component_mask[c] == false,
-                                               FETools::ExcFENotPrimitive());
-
-                                  // let's pick the first of possibly more than
-                                  // one non-zero components. if shape function
-                                  // is non-primitive, then we will ignore the
-                                  // result in the following anyway, otherwise
-                                  // there's only one non-zero component which
-                                  // we will use
-                                  component = fe.get_nonzero_components(cell_i)
-                                                .first_selected_component();
-                                }
-
-                              if (component_mask[component] == true)
-                                boundary_values[face_dofs[i]] =
-                                  dof_values_system[i](component);
-                            }
-                        }
-                      else
-                        // FE has only one component, so save some computations
-                        {
-                          // get only the one component that this function has
-                          dof_values_scalar.resize(fe.n_dofs_per_face(face_no));
-                          function_map.find(boundary_component)
-                            ->second->value_list(dof_locations,
-                                                 dof_values_scalar,
-                                                 0);
-
-                          // enter into list
-
-                          for (unsigned int i = 0; i < face_dofs.size(); ++i)
-                            boundary_values[face_dofs[i]] =
-                              dof_values_scalar[i];
-                        }
-                    }
-                }
+                                                       fe.n_dofs_per_line() ?
+                                                 i +
+                                                   4 *
+                                                     fe.n_dofs_per_vertex() :
+                                                 i +
+                                                   4 *
+                                                     fe.n_dofs_per_vertex() +
+                                                   8 *
+                                                     fe.n_dofs_per_line())) :
+                                           numbers::invalid_unsigned_int)));
+                                Assert(cell_i < fe.n_dofs_per_cell(),
+                                       ExcInternalError());
+
+                                // make sure that if this is not a primitive
+                                // shape function, then all the corresponding
+                                // components in the mask are not set
+                                if (!fe.is_primitive(cell_i))
+                                  for (unsigned int c = 0; c < n_components;
+                                       ++c)
+                                    if (fe.get_nonzero_components(cell_i)[c])
+                                      Assert(component_mask[c] == false,
+                                             FETools::ExcFENotPrimitive());
+
+                                // let's pick the first of possibly more than
+                                // one non-zero components. if shape function
+                                // is non-primitive, then we will ignore the
+                                // result in the following anyway, otherwise
+                                // there's only one non-zero component which
+                                // we will use
+                                component = fe.get_nonzero_components(cell_i)
+                                              .first_selected_component();
+                              }
+
+                            if (component_mask[component] == true)
+                              copy_data.emplace_back(
+                                face_dofs[i], dof_values_system[i](component));
+                          }
+                      }
+                    else
+                      // FE has only one component, so save some computations
+                      {
+                        // get only the one component that this function has
+                        dof_values_scalar.resize(fe.n_dofs_per_face(face_no));
+                        function_map.find(boundary_component)
+                          ->second->value_list(dof_locations,
+                                               dof_values_scalar,
+                                               0);
+
+                        // enter into list
+
+                        for (unsigned int i = 0; i < face_dofs.size(); ++i)
+                          copy_data.emplace_back(face_dofs[i],
+                                                 dof_values_scalar[i]);
+                      }
+                  }
+              }
+          };
+
+          const auto copier = [&boundary_values](const CopyData &copy_data) {
+            for (const auto &[index, value] : copy_data)
+              boundary_values[index] = value;
+          };
+
+          using CellFilter = FilteredIterator<
+            typename DoFHandler<dim, spacedim>::active_cell_iterator>;
+          const auto at_boundary =
+            [](const typename DoFHandler<dim, spacedim>::active_cell_iterator
+                 &cell) {
+              return !cell->is_artificial() && cell->at_boundary();
+            };
+          WorkStream::run(CellFilter(at_boundary, dof.begin_active()),
+                          CellFilter(at_boundary, dof.end()),
+                          worker,
+                          copier,
+                          sample_scratch,
+                          CopyData());
         }
     } // end of interpolate_boundary_values
   }   // namespace internal
@@ -18,6 +18,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_space.h>
+
 #include <deal.II/numerics/vector_tools_common.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -30,6 +32,8 @@ template <int dim, typename Number>
 class Function;
 template <int dim, int spacedim>
 class Mapping;
+template <int dim, typename number, typename VectorizedArrayType>
+class MatrixFree;
 template <int dim>
 class Quadrature;
 
@@ -45,6 +49,15 @@ namespace hp
   class QCollection;
 } // namespace hp
 
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+
 
 namespace VectorTools
 {
@@ -135,6 +148,13 @@ namespace VectorTools
    * from different processors need to be combined, see
    * VectorTools::compute_global_error().
    *
+   * @note The errors are computed on several cells concurrently using
+   * WorkStream (see
+   * @ref threads "Parallel computing with multiple processors"),
+   * so @p exact_solution and @p weight must support concurrent calls to their
+   * <code>const</code> member functions. The result does not depend on the
+   * number of threads used.
+   *
    * Instantiations for this template are provided for some vector types (see
    * the general documentation of the namespace), but only for InVectors as in
    * the documentation of the namespace, OutVector only Vector<double> and
@@ -209,6 +229,47 @@ namespace VectorTools
                             const Function<spacedim, double> *weight = nullptr,
                             const double                      exponent = 2.);
 
+  /**
+   * Same as above, but evaluate the finite element function with the
+   * sum-factorization kernels of FEEvaluation on the cells of the given
+   * MatrixFree object instead of with FEValues. The finite element
+   * solution is interpolated to the quadrature points of several cells at
+   * once using SIMD instructions, and the cell batches are distributed to
+   * the available threads. This is typically considerably faster than the
+   * FEValues-based variants above for the element types supported by
+   * MatrixFree.
+   *
+   * Only the norms NormType::L2_norm, NormType::H1_seminorm,
+   * NormType::H1_norm, and NormType::Linfty_norm are supported, and no
+   * weight function can be given. The quadrature formula is the one with
+   * index @p quad_no in @p matrix_free, and @p fe_function is a vector
+   * compatible with the DoFHandler with index @p dof_no. Ghost values of
+   * @p fe_function are updated if necessary and reset afterwards. The
+   * function also works for MatrixFree objects set up for hp-finite
+   * elements, in which case each cell uses the element and quadrature
+   * formula of its active FE index.
+   *
+   * The MatrixFree object needs to be set up with the
+   * UpdateFlags update_quadrature_points and update_JxW_values, as well as
+   * update_gradients for the norms involving derivatives. As for the
+   * functions above, the entries of @p difference for cells that are not
+   * locally owned are zero.
+   *
+   * @note Instantiated for MatrixFree objects over double and float with
+   * OutVector Vector<double> and Vector<float>.
+   */
+  template <int dim, typename Number, class OutVector>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+    const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+                                &fe_function,
+    const Function<dim, Number> &exact_solution,
+    OutVector                   &difference,
+    const NormType              &norm,
+    const unsigned int           dof_no  = 0,
+    const unsigned int           quad_no = 0);
+
   /**
    * Take a Vector @p cellwise_error of errors on each cell with
    * <tt>tria.n_active_cells()</tt> entries and return the global
@@ -17,6 +17,9 @@
 #define dealii_vector_tools_integrate_difference_templates_h
 
 
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/block_vector.h>
@@ -27,6 +30,9 @@
 #include <deal.II/lac/trilinos_parallel_block_vector.h>
 #include <deal.II/lac/trilinos_vector.h>
 
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
 #include <deal.II/numerics/vector_tools_integrate_difference.h>
 
 #include <limits>
@@ -506,42 +512,59 @@ namespace VectorTools
 
       const dealii::hp::FECollection<dim, spacedim> &fe_collection =
         dof.get_fe_collection();
-      IDScratchData<dim, spacedim, Number> data(mapping,
-                                                fe_collection,
-                                                q,
-                                                update_flags);
-
-      // loop over all cells
-      for (const auto &cell : dof.active_cell_iterators())
-        if (cell->is_locally_owned())
-          {
-            // initialize for this cell
-            data.x_fe_values.reinit(cell);
-
-            const dealii::FEValues<dim, spacedim> &fe_values =
-              data.x_fe_values.get_present_fe_values();
-            const unsigned int n_q_points = fe_values.n_quadrature_points;
-            data.resize_vectors(n_q_points, n_components);
-
-            if (update_flags & update_values)
-              fe_values.get_function_values(fe_function, data.function_values);
-            if (update_flags & update_gradients)
-              fe_values.get_function_gradients(fe_function,
-                                               data.function_grads);
-
-            difference(cell->active_cell_index()) =
-              integrate_difference_inner<dim, spacedim, Number>(exact_solution,
-                                                                norm,
-                                                                weight,
-                                                                update_flags,
-                                                                exponent,
-                                                                n_components,
-                                                                data);
-          }
-        else
-          // the cell is a ghost cell or is artificial. write a zero into the
-          // corresponding value of the returned vector
-          difference(cell->active_cell_index()) = 0;
+      const IDScratchData<dim, spacedim, Number> sample_data(mapping,
+                                                             fe_collection,
+                                                             q,
+                                                             update_flags);
+
+      // loop over all cells in parallel. every thread works on its own copy
+      // of the scratch data, and the copier writes the error of each cell
+      // into the output vector
+      using CopyData = std::pair<unsigned int, double>;
+      WorkStream::run(
+        dof.begin_active(),
+        dof.end(),
+        [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator
+                                                 &cell,
+            IDScratchData<dim, spacedim, Number> &data,
+            CopyData                             &copy_data) {
+          copy_data.first = cell->active_cell_index();
+
+          // if the cell is a ghost cell or is artificial, write a zero into
+          // the corresponding value of the returned vector
+          if (!cell->is_locally_owned())
+            {
+              copy_data.second = 0;
+              return;
+            }
+
+          // initialize for this cell
+          data.x_fe_values.reinit(cell);
+
+          const dealii::FEValues<dim, spacedim> &fe_values =
+            data.x_fe_values.get_present_fe_values();
+          const unsigned int n_q_points = fe_values.n_quadrature_points;
+          data.resize_vectors(n_q_points, n_components);
+
+          if (update_flags & update_values)
+            fe_values.get_function_values(fe_function, data.function_values);
+          if (update_flags & update_gradients)
+            fe_values.get_function_gradients(fe_function, data.function_grads);
+
+          copy_data.second =
+            integrate_difference_inner<dim, spacedim, Number>(exact_solution,
+                                                              norm,
+                                                              weight,
+                                                              update_flags,
+                                                              exponent,
+                                                              n_components,
+                                                              data);
+        },
+        [&difference](const CopyData &copy_data) {
+          difference(copy_data.first) = copy_data.second;
+        },
+        sample_data,
+        CopyData());
     }
 
   } // namespace internal
@@ -644,6 +667,158 @@ namespace VectorTools
       exponent);
   }
 
+  template <int dim, typename Number, class OutVector>
+  void
+  integrate_difference(
+    const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+    const LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>
+                                &fe_function,
+    const Function<dim, Number> &exact_solution,
+    OutVector                   &difference,
+    const NormType              &norm,
+    const unsigned int           dof_no,
+    const unsigned int           quad_no)
+  {
+    AssertThrow(norm == L2_norm || norm == H1_seminorm || norm == H1_norm ||
+                  norm == Linfty_norm,
+                ExcMessage("The MatrixFree variant of integrate_difference() "
+                           "only supports the L2 norm, the H1 seminorm, the "
+                           "H1 norm, and the Linfty norm."));
+
+    Assert(matrix_free.get_mg_level() == numbers::invalid_unsigned_int,
+           ExcMessage("The MatrixFree object needs to be set up on the "
+                      "active cells."));
+
+    const DoFHandler<dim> &dof = matrix_free.get_dof_handler(dof_no);
+    const unsigned int     n_components =
+      dof.get_fe_collection().n_components();
+    AssertDimension(exact_solution.n_components, n_components);
+
+    difference.reinit(dof.get_triangulation().n_active_cells());
+
+    const bool need_values    = (norm != H1_seminorm);
+    const bool need_gradients = (norm == H1_seminorm || norm == H1_norm);
+    EvaluationFlags::EvaluationFlags evaluation_flags =
+      EvaluationFlags::nothing;
+    if (need_values)
+      evaluation_flags |= EvaluationFlags::values;
+    if (need_gradients)
+      evaluation_flags |= EvaluationFlags::gradients;
+
+    const bool has_ghost_elements = fe_function.has_ghost_elements();
+    if (has_ghost_elements == false)
+      fe_function.update_ghost_values();
+
+    // the errors of the cells are collected in a vector indexed by the
+    // active cell index, which every thread can write into without
+    // synchronization because every cell appears in exactly one cell batch
+    std::vector<double> cell_errors(difference.size(), 0.);
+
+    using FEEval = FEEvaluation<dim, -1, 0, 1, Number>;
+    constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+
+    parallel::apply_to_subranges(
+      0U,
+      matrix_free.n_cell_batches(),
+      [&](const unsigned int begin, const unsigned int end) {
+        // one evaluator per vector component of the finite element. In the
+        // hp-case, the evaluators are set up again whenever the active FE
+        // index changes between two cell batches of the range.
+        std::vector<std::unique_ptr<FEEval>> phi(n_components);
+        unsigned int active_fe_index = numbers::invalid_unsigned_int;
+
+        for (unsigned int cell = begin; cell < end; ++cell)
+          {
+            const std::pair<unsigned int, unsigned int> cell_range(cell,
+                                                                   cell + 1);
+            if (matrix_free.get_cell_active_fe_index(cell_range) !=
+                active_fe_index)
+              {
+                active_fe_index =
+                  matrix_free.get_cell_active_fe_index(cell_range);
+                for (unsigned int c = 0; c < n_components; ++c)
+                  phi[c] = std::make_unique<FEEval>(
+                    matrix_free, cell_range, dof_no, quad_no, c);
+              }
+
+            const unsigned int n_filled_lanes =
+              matrix_free.n_active_entries_per_cell_batch(cell);
+            std::array<double, n_lanes> error_values    = {};
+            std::array<double, n_lanes> error_gradients = {};
+
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                FEEval &fe_eval = *phi[c];
+                fe_eval.reinit(cell);
+                fe_eval.read_dof_values_plain(fe_function);
+                fe_eval.evaluate(evaluation_flags);
+
+                for (const unsigned int q : fe_eval.quadrature_point_indices())
+                  {
+                    const Point<dim, VectorizedArray<Number>> p_vectorized =
+                      fe_eval.quadrature_point(q);
+                    const VectorizedArray<Number> JxW = fe_eval.JxW(q);
+
+                    VectorizedArray<Number> value = {};
+                    Tensor<1, dim, VectorizedArray<Number>> gradient;
+                    if (need_values)
+                      value = fe_eval.get_value(q);
+                    if (need_gradients)
+                      gradient = fe_eval.get_gradient(q);
+
+                    // the finite element function is evaluated for all
+                    // lanes at once, the exact solution one point at a time
+                    for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                      {
+                        Point<dim> p;
+                        for (unsigned int d = 0; d < dim; ++d)
+                          p[d] = p_vectorized[d][v];
+
+                        if (need_values)
+                          {
+                            const double diff =
+                              value[v] - exact_solution.value(p, c);
+                            if (norm == Linfty_norm)
+                              error_values[v] =
+                                std::max(error_values[v], std::abs(diff));
+                            else
+                              error_values[v] += diff * diff * JxW[v];
+                          }
+
+                        if (need_gradients)
+                          {
+                            const Tensor<1, dim, Number> exact_gradient =
+                              exact_solution.gradient(p, c);
+                            for (unsigned int d = 0; d < dim; ++d)
+                              {
+                                const double diff =
+                                  gradient[d][v] - exact_gradient[d];
+                                error_gradients[v] += diff * diff * JxW[v];
+                              }
+                          }
+                      }
+                  }
+              }
+
+            for (unsigned int v = 0; v < n_filled_lanes; ++v)
+              cell_errors[matrix_free.get_cell_iterator(cell, v, dof_no)
+                            ->active_cell_index()] =
+                (norm == Linfty_norm ?
+                   error_values[v] :
+                   std::sqrt(error_values[v] + error_gradients[v]));
+          }
+      },
+      8);
+
+    if (has_ghost_elements == false)
+      fe_function.zero_out_ghost_values();
+
+    for (unsigned int i = 0; i < cell_errors.size(); ++i)
+      difference(i) = cell_errors[i];
+  }
+
+
+
   template <int dim, int spacedim, class InVector>
   DEAL_II_CXX20_REQUIRES(concepts::is_dealii_vector_type<InVector>)
   double compute_global_error(const Triangulation<dim, spacedim> &tria,
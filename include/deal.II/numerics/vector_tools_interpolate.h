@@ -66,6 +66,13 @@ namespace VectorTools
    * with the hanging nodes from space @p dof afterwards, to make the result
    * continuous again.
    *
+   * The function is evaluated on several cells concurrently using
+   * WorkStream (see
+   * @ref threads "Parallel computing with multiple processors"),
+   * so @p function must support concurrent calls to its
+   * <code>const</code> member functions. The result does not depend on the
+   * number of threads used.
+   *
    * See the general documentation of this namespace for further information.
    *
    * @dealiiConceptRequires{concepts::is_writable_dealii_vector_type<VectorType>}
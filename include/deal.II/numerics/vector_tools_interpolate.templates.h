@@ -16,6 +16,8 @@
 #define dealii_vector_tools_interpolate_templates_h
 
 
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/dofs/dof_tools.h>
 
 #include <deal.II/fe/fe_q.h>
@@ -219,6 +221,51 @@ namespace VectorTools
     }
 
 
+    // Per-thread scratch object for the cell loop in interpolate() below:
+    // each thread evaluates the (generalized) support points on its own
+    // copy of the hp::FEValues object and keeps its own temporary arrays
+    // for dof indices as well as function and dof values, the latter one
+    // per element of the FECollection.
+    template <int dim, int spacedim, typename number>
+    struct InterpolateScratchData
+    {
+      InterpolateScratchData(
+        const hp::MappingCollection<dim, spacedim> &mapping_collection,
+        const hp::FECollection<dim, spacedim>      &fe,
+        const hp::QCollection<dim>                 &support_quadrature,
+        const UpdateFlags                           update_flags)
+        : fe_values(mapping_collection, fe, support_quadrature, update_flags)
+        , fe_function_values(fe.size())
+        , fe_dof_values(fe.size())
+      {
+        dofs_on_cell.reserve(fe.max_dofs_per_cell());
+      }
+
+      InterpolateScratchData(const InterpolateScratchData &scratch) = default;
+
+      hp::FEValues<dim, spacedim>              fe_values;
+      std::vector<types::global_dof_index>     dofs_on_cell;
+      std::vector<std::vector<Vector<number>>> fe_function_values;
+      std::vector<std::vector<number>>         fe_dof_values;
+    };
+
+
+
+    // Copy object for the cell loop in interpolate(): the global indices of
+    // all degrees of freedom the cell contributes to together with the
+    // contributed values, and the indices of the degrees of freedom whose
+    // current value is to be kept because their component is not selected.
+    // Each contribution carries a weight of one.
+    template <typename number>
+    struct InterpolateCopyData
+    {
+      std::vector<types::global_dof_index> dof_indices;
+      std::vector<number>                  values;
+      std::vector<types::global_dof_index> kept_dof_indices;
+    };
+
+
+
     // Internal implementation of interpolate that takes a generic functor
     // function such that function(cell) is of type
     // Function<spacedim, typename VectorType::value_type>*
@@ -288,18 +335,6 @@ namespace VectorTools
       const hp::FECollection<dim, spacedim> &fe(
         dof_handler.get_fe_collection());
 
-      std::vector<types::global_dof_index> dofs_on_cell(fe.max_dofs_per_cell());
-
-      // Temporary storage for cell-wise interpolation operation. We store a
-      // variant for every FE we encounter to speed up resizing operations.
-      // The first vector is used for local function evaluation. The vector
-      // dof_values is used to store intermediate cell-wise interpolation
-      // results (see the detailed explanation in the for loop further down
-      // below).
-
-      std::vector<std::vector<Vector<number>>> fe_function_values(fe.size());
-      std::vector<std::vector<number>>         fe_dof_values(fe.size());
-
       // We will need two temporary global vectors that store the new values
       // and weights.
       VectorType interpolation;
@@ -344,21 +379,46 @@ namespace VectorTools
             }
         }
 
-      // An FEValues object to evaluate (generalized) support point
-      // locations as well as Jacobians and their inverses.
-      // The latter are only needed for Hcurl or Hdiv conforming elements,
-      // but we'll just always include them.
-      hp::FEValues<dim, spacedim> fe_values(mapping_collection,
-                                            fe,
-                                            support_quadrature,
-                                            update_quadrature_points |
-                                              update_jacobians |
-                                              update_inverse_jacobians);
+      // The scratch object holds an FEValues object to evaluate
+      // (generalized) support point locations as well as Jacobians and
+      // their inverses. The latter are only needed for Hcurl or Hdiv
+      // conforming elements, but we'll just always include them.
+      //
+      // The temporary storage for the cell-wise interpolation operation
+      // stores a variant for every FE we encounter to speed up resizing
+      // operations. The function values are used for local function
+      // evaluation, the dof values store intermediate cell-wise
+      // interpolation results (see the detailed explanation in the
+      // worker further down below).
+      using ScratchData = InterpolateScratchData<dim, spacedim, number>;
+      using CopyData    = InterpolateCopyData<number>;
+
+      const ScratchData sample_scratch(mapping_collection,
+                                       fe,
+                                       support_quadrature,
+                                       update_quadrature_points |
+                                         update_jacobians |
+                                         update_inverse_jacobians);
+
+      CopyData sample_copy;
+      sample_copy.dof_indices.reserve(fe.max_dofs_per_cell());
+      sample_copy.values.reserve(fe.max_dofs_per_cell());
 
       //
-      // Now loop over all locally owned, active cells.
+      // Now loop over all locally owned, active cells. Evaluating the
+      // function in the support points is typically by far the most
+      // expensive part of this function and independent between cells, so
+      // we do it in parallel with WorkStream. The local contributions are
+      // added to the global vectors sequentially and in the order of the
+      // cells, which gives results identical to a serial loop.
       //
-      const auto runner = [&](const auto &cell) {
+      const auto worker = [&](const auto  &cell,
+                              ScratchData &scratch,
+                              CopyData    &copy_data) {
+        copy_data.dof_indices.clear();
+        copy_data.values.clear();
+        copy_data.kept_dof_indices.clear();
+
         const unsigned int fe_index = cell->active_fe_index();
 
         // Do nothing if there are no local degrees of freedom.
@@ -372,18 +432,20 @@ namespace VectorTools
           return;
 
         // Get transformed, generalized support points
+        auto &fe_values = scratch.fe_values;
         fe_values.reinit(cell);
         const std::vector<Point<spacedim>> &generalized_support_points =
           fe_values.get_present_fe_values().get_quadrature_points();
 
         // Get indices of the dofs on this cell
         const auto n_dofs = fe[fe_index].n_dofs_per_cell();
+        auto &dofs_on_cell = scratch.dofs_on_cell;
         dofs_on_cell.resize(n_dofs);
         cell->get_active_or_mg_dof_indices(dofs_on_cell);
 
         // Prepare temporary storage
-        auto &function_values = fe_function_values[fe_index];
-        auto &dof_values      = fe_dof_values[fe_index];
+        auto &function_values = scratch.fe_function_values[fe_index];
+        auto &dof_values      = scratch.fe_dof_values[fe_index];
 
         const auto n_components = fe[fe_index].n_components();
         // Only resize (and create sample entry) if sizes do not match
@@ -450,59 +512,79 @@ namespace VectorTools
                   }
 #endif
 
-                // Add local values to the global vectors
+                // Record the local values for the global vectors
+                copy_data.dof_indices.push_back(dofs_on_cell[i]);
                 if (needs_expensive_algorithm[fe_index])
-                  ::dealii::internal::ElementAccess<VectorType>::add(
-                    dof_values[i], dofs_on_cell[i], interpolation);
+                  copy_data.values.push_back(dof_values[i]);
                 else
                   {
                     const auto base_index =
                       fe[fe_index].system_to_base_index(i);
-                    ::dealii::internal::ElementAccess<VectorType>::add(
+                    copy_data.values.push_back(
                       function_values[base_index.second]
-                                     [base_index.first.second],
-                      dofs_on_cell[i],
-                      interpolation);
+                                     [base_index.first.second]);
                   }
-                ::dealii::internal::ElementAccess<VectorType>::add(
-                  typename VectorType::value_type(1.0),
-                  dofs_on_cell[i],
-                  weights);
               }
             else
               {
                 // If a component is ignored, copy the dof values
                 // from the vector "vec", but only if they are locally
-                // available
+                // available. The vector is only read in the copier
+                // below, i.e., not concurrently.
                 if (locally_owned_dofs.is_element(dofs_on_cell[i]))
-                  {
-                    const auto value =
-                      ::dealii::internal::ElementAccess<VectorType>::get(
-                        vec, dofs_on_cell[i]);
-                    ::dealii::internal::ElementAccess<VectorType>::add(
-                      value, dofs_on_cell[i], interpolation);
-                    ::dealii::internal::ElementAccess<VectorType>::add(
-                      typename VectorType::value_type(1.0),
-                      dofs_on_cell[i],
-                      weights);
-                  }
+                  copy_data.kept_dof_indices.push_back(dofs_on_cell[i]);
               }
           }
       };
 
+      // Add local values to the global vectors
+      const auto copier = [&](const CopyData &copy_data) {
+        for (unsigned int i = 0; i < copy_data.dof_indices.size(); ++i)
+          {
+            ::dealii::internal::ElementAccess<VectorType>::add(
+              copy_data.values[i], copy_data.dof_indices[i], interpolation);
+            ::dealii::internal::ElementAccess<VectorType>::add(
+              typename VectorType::value_type(1.0),
+              copy_data.dof_indices[i],
+              weights);
+          }
+        for (const auto i : copy_data.kept_dof_indices)
+          {
+            const auto value =
+              ::dealii::internal::ElementAccess<VectorType>::get(vec, i);
+            ::dealii::internal::ElementAccess<VectorType>::add(value,
+                                                               i,
+                                                               interpolation);
+            ::dealii::internal::ElementAccess<VectorType>::add(
+              typename VectorType::value_type(1.0), i, weights);
+          }
+      };
+
       if (level == numbers::invalid_unsigned_int)
         {
-          for (const auto &cell : dof_handler.active_cell_iterators())
-            {
-              if (cell->is_locally_owned())
-                runner(cell);
-            }
+          using CellFilter = FilteredIterator<
+            typename DoFHandler<dim, spacedim>::active_cell_iterator>;
+          WorkStream::run(CellFilter(IteratorFilters::LocallyOwnedCell(),
+                                     dof_handler.begin_active()),
+                          CellFilter(IteratorFilters::LocallyOwnedCell(),
+                                     dof_handler.end()),
+                          worker,
+                          copier,
+                          sample_scratch,
+                          sample_copy);
         }
       else
         {
-          for (const auto &cell : dof_handler.mg_cell_iterators_on_level(level))
-            if (cell->is_locally_owned_on_level())
-              runner(cell);
+          using CellFilter = FilteredIterator<
+            typename DoFHandler<dim, spacedim>::level_cell_iterator>;
+          WorkStream::run(CellFilter(IteratorFilters::LocallyOwnedLevelCell(),
+                                     dof_handler.begin_mg(level)),
+                          CellFilter(IteratorFilters::LocallyOwnedLevelCell(),
+                                     dof_handler.end_mg(level)),
+                          worker,
+                          copier,
+                          sample_scratch,
+                          sample_copy);
         }
 
       interpolation.compress(VectorOperation::add);
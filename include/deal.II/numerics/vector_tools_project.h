@@ -18,6 +18,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_space.h>
+
 #include <functional>
 #include <memory>
 
@@ -49,6 +51,14 @@ namespace hp
   template <int dim>
   class QCollection;
 } // namespace hp
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
 
 
 namespace VectorTools
@@ -315,6 +325,53 @@ namespace VectorTools
     VectorType                                               &vec_result,
     const unsigned int                                        fe_component = 0);
 
+  /**
+   * Compute the projection of @p function to the finite element space
+   * described by the DoFHandler with index @p dof_no in @p matrix_free,
+   * using the quadrature formula with index @p quad_no for both the mass
+   * operator and the right hand side. The whole algorithm runs on the
+   * MatrixFree object: the right hand side is computed by the MatrixFree
+   * variant of create_right_hand_side(), and the
+   * @ref GlossMassMatrix "mass matrix" is only applied through its action on
+   * the cell batches. The cell loops
+   * run on several threads if @p matrix_free was set up with a task-parallel
+   * scheme, and @p vec may be distributed over several MPI ranks. The
+   * elements may be vector-valued, and the DoFHandler may use an
+   * hp::FECollection, in which case the MatrixFree object needs an
+   * hp::QCollection for @p quad_no.
+   *
+   * Depending on the element, one of two solvers is used:
+   * - If all elements of the DoFHandler are discontinuous tensor product
+   *   elements like FE_DGQ, @p constraints is empty, and the
+   *   quadrature formula has $k+1$ points per direction for elements of
+   *   degree $k$, the mass matrix is block-diagonal with blocks that can be
+   *   inverted by sum factorization. The projection is then computed in a
+   *   single cell loop with MatrixFreeOperators::CellwiseInverseMassMatrix,
+   *   without any global linear solver.
+   * - Otherwise, the mass matrix system is solved with a conjugate gradient
+   *   method, preconditioned by a Chebyshev iteration around the inverse
+   *   lumped diagonal of the mass matrix, or the inverse of its diagonal if
+   *   the lumped diagonal has non-positive entries. Compared to the point
+   *   Jacobi method of the other MatrixFree variants, this takes fewer
+   *   global reductions at the same number of matrix-vector products.
+   *
+   * @p constraints must be the object that was used to set up the DoFHandler
+   * with index @p dof_no in @p matrix_free; inhomogeneous constraints are
+   * supported. The MatrixFree object needs to be set up with the UpdateFlags
+   * update_values, update_quadrature_points, and update_JxW_values. The
+   * vector @p vec is reinitialized by this function.
+   *
+   * @note Instantiated for MatrixFree objects over double and float.
+   */
+  template <int dim, typename Number>
+  void
+  project(const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+          const AffineConstraints<Number>                        &constraints,
+          const Function<dim, Number>                            &function,
+          LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+          const unsigned int dof_no  = 0,
+          const unsigned int quad_no = 0);
+
   /** @} */
 
 } // namespace VectorTools
@@ -34,7 +34,10 @@
 #include <deal.II/lac/trilinos_parallel_block_vector.h>
 #include <deal.II/lac/trilinos_vector.h>
 
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/operators.h>
+#include <deal.II/matrix_free/tools.h>
 
 #include <deal.II/numerics/matrix_tools.h>
 #include <deal.II/numerics/vector_tools_boundary.h>
@@ -869,6 +872,204 @@ namespace VectorTools
                  project_to_boundary_first);
     }
 
+
+
+    /**
+     * The @ref GlossMassMatrix "mass matrix" of the MatrixFree variant of
+     * project() that works on a MatrixFree object provided by the user. In
+     * contrast to MatrixFreeOperators::MassOperator, the number of
+     * components is a run time quantity, the quadrature formula can be
+     * selected, and hp::FECollection objects are supported. Rows of
+     * constrained degrees of freedom are replaced by the identity.
+     */
+    template <int dim, typename Number>
+    class ProjectionMassOperator : public Subscriptor
+    {
+    public:
+      using VectorType = LinearAlgebra::distributed::Vector<Number>;
+      using value_type = Number;
+      using size_type  = types::global_dof_index;
+
+      ProjectionMassOperator(
+        const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+        const AffineConstraints<Number>                        &constraints,
+        const unsigned int                                      dof_no,
+        const unsigned int                                      quad_no)
+        : matrix_free(matrix_free)
+        , dof_no(dof_no)
+        , quad_no(quad_no)
+        , n_components(matrix_free.get_dof_handler(dof_no)
+                         .get_fe_collection()
+                         .n_components())
+        , inverse_diagonal(std::make_shared<DiagonalMatrix<VectorType>>())
+      {
+        const auto &partitioner = matrix_free.get_vector_partitioner(dof_no);
+        for (const auto &line : constraints.get_lines())
+          if (partitioner->in_local_range(line.index))
+            constrained_dofs.push_back(
+              partitioner->global_to_local(line.index));
+      }
+
+      size_type
+      m() const
+      {
+        return matrix_free.get_vector_partitioner(dof_no)->size();
+      }
+
+      Number
+      el(const size_type row, const size_type col) const
+      {
+        (void)col;
+        Assert(row == col, ExcNotImplemented());
+        Assert(inverse_diagonal->m() > 0, ExcNotInitialized());
+        return Number(1.) / (*inverse_diagonal)(row, row);
+      }
+
+      void
+      vmult(VectorType &dst, const VectorType &src) const
+      {
+        matrix_free.cell_loop(
+          &ProjectionMassOperator::local_apply, this, dst, src, true);
+        for (const unsigned int i : constrained_dofs)
+          dst.local_element(i) = src.local_element(i);
+      }
+
+      /**
+       * Compute the inverse of the lumped diagonal of the mass matrix, or of
+       * its diagonal if the lumped diagonal has non-positive entries on any
+       * MPI rank.
+       */
+      void
+      compute_inverse_diagonal()
+      {
+        VectorType &inverse_diagonal_vector = inverse_diagonal->get_vector();
+        VectorType  ones;
+        matrix_free.initialize_dof_vector(ones, dof_no);
+        matrix_free.initialize_dof_vector(inverse_diagonal_vector, dof_no);
+        ones = Number(1.);
+        vmult(inverse_diagonal_vector, ones);
+
+        bool all_entries_positive = true;
+        for (const Number &v : inverse_diagonal_vector)
+          if (!(v > Number(0.)))
+            {
+              all_entries_positive = false;
+              break;
+            }
+
+        if (Utilities::MPI::min(int(all_entries_positive),
+                                ones.get_mpi_communicator()) == 0)
+          {
+            std::function<void(FEEvaluation<dim, -1, 0, 1, Number> &)>
+              mass_kernel = [](auto &phi) {
+                phi.evaluate(EvaluationFlags::values);
+                for (const unsigned int q : phi.quadrature_point_indices())
+                  phi.submit_value(phi.get_value(q), q);
+                phi.integrate(EvaluationFlags::values);
+              };
+
+            // the diagonal of each component only has entries on the
+            // degrees of freedom of that component, so we can sum them up
+            inverse_diagonal_vector = Number(0.);
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                MatrixFreeTools::compute_diagonal(
+                  matrix_free, ones, mass_kernel, dof_no, quad_no, c);
+                inverse_diagonal_vector += ones;
+              }
+            for (const unsigned int i : constrained_dofs)
+              inverse_diagonal_vector.local_element(i) = Number(1.);
+          }
+
+        for (Number &v : inverse_diagonal_vector)
+          {
+            Assert(v > Number(0.), ExcInternalError());
+            v = Number(1.) / v;
+          }
+      }
+
+      const std::shared_ptr<DiagonalMatrix<VectorType>> &
+      get_matrix_diagonal_inverse() const
+      {
+        return inverse_diagonal;
+      }
+
+    private:
+      void
+      local_apply(
+        const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+        VectorType                                             &dst,
+        const VectorType                                       &src,
+        const std::pair<unsigned int, unsigned int> &cell_range) const
+      {
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            FEEvaluation<dim, -1, 0, 1, Number> phi(
+              matrix_free, cell_range, dof_no, quad_no, c);
+            for (unsigned int cell = cell_range.first; cell < cell_range.second;
+                 ++cell)
+              {
+                phi.reinit(cell);
+                phi.gather_evaluate(src, EvaluationFlags::values);
+                for (const unsigned int q : phi.quadrature_point_indices())
+                  phi.submit_value(phi.get_value(q), q);
+                phi.integrate_scatter(EvaluationFlags::values, dst);
+              }
+          }
+      }
+
+      const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free;
+      const unsigned int                                      dof_no;
+      const unsigned int                                      quad_no;
+      const unsigned int                                      n_components;
+      std::vector<unsigned int>                               constrained_dofs;
+      std::shared_ptr<DiagonalMatrix<VectorType>>             inverse_diagonal;
+    };
+
+
+
+    /**
+     * Return whether the MatrixFree variant of project() can invert the
+     * @ref GlossMassMatrix "mass matrix" cell by cell, i.e., whether all
+     * elements are discontinuous tensor product elements whose quadrature
+     * formula has as many points per direction as the element has degrees of
+     * freedom, and whether there are no constraints.
+     */
+    template <int dim, typename Number>
+    bool
+    can_project_with_cellwise_inverse(
+      const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+      const AffineConstraints<Number>                        &constraints,
+      const unsigned int                                      dof_no,
+      const unsigned int                                      quad_no,
+      const MPI_Comm                                          comm)
+    {
+      if (Utilities::MPI::max(constraints.n_constraints(), comm) > 0)
+        return false;
+
+      const hp::FECollection<dim> &fe_collection =
+        matrix_free.get_dof_handler(dof_no).get_fe_collection();
+      for (unsigned int f = 0; f < fe_collection.size(); ++f)
+        {
+          if (fe_collection[f].n_dofs_per_face() > 0)
+            return false;
+
+          for (unsigned int c = 0; c < fe_collection.n_components(); ++c)
+            {
+              const FEEvaluation<dim, -1, 0, 1, Number> phi(
+                matrix_free, dof_no, quad_no, c, f);
+              const auto &shape_info = phi.get_shape_info();
+              if (shape_info.element_type >
+                    dealii::internal::MatrixFreeFunctions::
+                      tensor_symmetric_no_collocation ||
+                  shape_info.data.front().n_q_points_1d !=
+                    shape_info.data.front().fe_degree + 1)
+                return false;
+            }
+        }
+      return true;
+    }
+
   } // namespace internal
 
 
@@ -1040,6 +1241,146 @@ namespace VectorTools
             project_to_boundary_first);
   }
 
+
+
+  template <int dim, typename Number>
+  void
+  project(const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+          const AffineConstraints<Number>                        &constraints,
+          const Function<dim, Number>                            &function,
+          LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &vec,
+          const unsigned int dof_no,
+          const unsigned int quad_no)
+  {
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArray<Number>>;
+    using VectorType     = LinearAlgebra::distributed::Vector<Number>;
+    using FEEval         = FEEvaluation<dim, -1, 0, 1, Number>;
+
+    const unsigned int n_components =
+      matrix_free.get_dof_handler(dof_no).get_fe_collection().n_components();
+    AssertDimension(n_components, function.n_components);
+
+    matrix_free.initialize_dof_vector(vec, dof_no);
+    const MPI_Comm comm = vec.get_mpi_communicator();
+
+    // For discontinuous elements, the mass matrix is block-diagonal and we
+    // can apply the exact inverse on each cell batch, skipping the global
+    // linear solver altogether
+    if (internal::can_project_with_cellwise_inverse(
+          matrix_free, constraints, dof_no, quad_no, comm))
+      {
+        int dummy = 0;
+        matrix_free.template cell_loop<VectorType, int>(
+          [&](const MatrixFreeType                        &matrix_free,
+              VectorType                                  &dst,
+              const int                                   &,
+              const std::pair<unsigned int, unsigned int> &cell_range) {
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                FEEval phi(matrix_free, cell_range, dof_no, quad_no, c);
+                const MatrixFreeOperators::
+                  CellwiseInverseMassMatrix<dim, -1, 1, Number>
+                    inverse_mass(phi);
+                for (unsigned int cell = cell_range.first;
+                     cell < cell_range.second;
+                     ++cell)
+                  {
+                    phi.reinit(cell);
+                    const unsigned int n_filled_lanes =
+                      matrix_free.n_active_entries_per_cell_batch(cell);
+
+                    for (const unsigned int q : phi.quadrature_point_indices())
+                      {
+                        const Point<dim, VectorizedArray<Number>>
+                          p_vectorized = phi.quadrature_point(q);
+
+                        VectorizedArray<Number> values(Number(0.));
+                        for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                          {
+                            Point<dim> p;
+                            for (unsigned int d = 0; d < dim; ++d)
+                              p[d] = p_vectorized[d][v];
+                            values[v] = function.value(p, c);
+                          }
+                        phi.submit_value(values, q);
+                      }
+
+                    phi.integrate(EvaluationFlags::values);
+                    inverse_mass.apply(phi.begin_dof_values(),
+                                       phi.begin_dof_values());
+                    phi.set_dof_values(dst);
+                  }
+              }
+          },
+          vec,
+          dummy,
+          true);
+        return;
+      }
+
+    VectorType rhs;
+    matrix_free.initialize_dof_vector(rhs, dof_no);
+    create_right_hand_side(matrix_free, function, rhs, dof_no, quad_no);
+
+    // account for inhomogeneous constraints by subtracting the action of the
+    // mass matrix on the constrained values
+    if (Utilities::MPI::max(int(constraints.has_inhomogeneities()), comm) > 0)
+      {
+        VectorType inhomogeneities;
+        matrix_free.initialize_dof_vector(inhomogeneities, dof_no);
+        constraints.distribute(inhomogeneities);
+        matrix_free.template cell_loop<VectorType, VectorType>(
+          [&](const MatrixFreeType                        &matrix_free,
+              VectorType                                  &dst,
+              const VectorType                            &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) {
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                FEEval phi(matrix_free, cell_range, dof_no, quad_no, c);
+                for (unsigned int cell = cell_range.first;
+                     cell < cell_range.second;
+                     ++cell)
+                  {
+                    phi.reinit(cell);
+                    phi.read_dof_values_plain(src);
+                    phi.evaluate(EvaluationFlags::values);
+                    for (const unsigned int q : phi.quadrature_point_indices())
+                      phi.submit_value(-phi.get_value(q), q);
+                    phi.integrate(EvaluationFlags::values);
+                    phi.distribute_local_to_global(dst);
+                  }
+              }
+          },
+          rhs,
+          inhomogeneities,
+          false);
+      }
+
+    internal::ProjectionMassOperator<dim, Number> mass_operator(
+      matrix_free, constraints, dof_no, quad_no);
+    mass_operator.compute_inverse_diagonal();
+
+    using PreconditionerType =
+      PreconditionChebyshev<internal::ProjectionMassOperator<dim, Number>,
+                            VectorType,
+                            DiagonalMatrix<VectorType>>;
+    typename PreconditionerType::AdditionalData additional_data;
+    additional_data.preconditioner =
+      mass_operator.get_matrix_diagonal_inverse();
+    additional_data.degree = 3;
+    PreconditionerType preconditioner;
+    preconditioner.initialize(mass_operator, additional_data);
+
+    // Allow for a maximum of 6*n steps to reduce the residual by 10^-12, as
+    // in the other matrix-free implementation above
+    ReductionControl     control(6 * rhs.size(), 0., 1e-12, false, false);
+    SolverCG<VectorType> cg(control);
+    cg.solve(mass_operator, vec, rhs, preconditioner);
+
+    constraints.distribute(vec);
+  }
+
+
 } // namespace VectorTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_space.h>
+
 #include <set>
 
 DEAL_II_NAMESPACE_OPEN
@@ -32,6 +34,8 @@ template <int dim, typename Number>
 class Function;
 template <int dim, int spacedim>
 class Mapping;
+template <int dim, typename number, typename VectorizedArrayType>
+class MatrixFree;
 template <int dim>
 class Quadrature;
 namespace hp
@@ -41,6 +45,14 @@ namespace hp
   template <int dim>
   class QCollection;
 } // namespace hp
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename Number, typename MemorySpace>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
 
 
 namespace VectorTools
@@ -56,6 +68,12 @@ namespace VectorTools
    *
    * See the general documentation of this namespace for further information.
    *
+   * @note The cell contributions are computed on several cells concurrently
+   * using WorkStream (see
+   * @ref threads "Parallel computing with multiple processors"),
+   * so @p rhs must support concurrent calls to its <code>const</code> member
+   * functions. The result does not depend on the number of threads used.
+   *
    * @dealiiConceptRequires{concepts::is_writable_dealii_vector_type<VectorType>}
    */
   template <int dim, int spacedim, typename VectorType>
@@ -116,12 +134,46 @@ namespace VectorTools
     const AffineConstraints<typename VectorType::value_type>  &constraints =
       AffineConstraints<typename VectorType::value_type>());
 
+  /**
+   * Create a right hand side vector on the cells of a MatrixFree object.
+   * The function @p rhs is evaluated in the quadrature points with index
+   * @p quad_no and tested with the shape functions of the DoFHandler with
+   * index @p dof_no in @p matrix_free. The integration uses the
+   * sum-factorization kernels of FEEvaluation on batches of cells, and the
+   * cell loop of MatrixFree, which runs on several threads if the
+   * MatrixFree object was set up with a task-parallel scheme. The function
+   * itself is evaluated one quadrature point at a time. The constraints
+   * stored in @p matrix_free are applied when adding the cell contributions
+   * to @p rhs_vector, and prior content of @p rhs_vector is deleted.
+   *
+   * Since the right hand side can be computed without setting up FEValues
+   * objects, this function is particularly suited for forcing terms that
+   * change in every time step. The MatrixFree object needs to be set up with
+   * the UpdateFlags update_quadrature_points and update_JxW_values.
+   *
+   * @note Instantiated for MatrixFree objects over double and float.
+   */
+  template <int dim, typename Number>
+  void
+  create_right_hand_side(
+    const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+    const Function<dim, Number>                            &rhs,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &rhs_vector,
+    const unsigned int                                             dof_no  = 0,
+    const unsigned int                                             quad_no = 0);
+
   /**
    * Create a right hand side vector from boundary forces. Prior content of
    * the given @p rhs_vector vector is deleted.
    *
    * See the general documentation of this namespace for further information.
    *
+   * @note The face contributions are computed on several cells concurrently
+   * using WorkStream (see
+   * @ref threads "Parallel computing with multiple processors"),
+   * so @p rhs must support concurrent calls to its <code>const</code> member
+   * functions. The result does not depend on the number of threads used.
+   *
    * @see
    * @ref GlossBoundaryIndicator "Glossary entry on boundary indicators"
    *
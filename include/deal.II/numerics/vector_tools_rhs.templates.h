@@ -15,8 +15,12 @@
 #ifndef dealii_vector_tools_rhs_templates_h
 #define dealii_vector_tools_rhs_templates_h
 
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/fe/mapping_q1.h>
 
+#include <deal.II/grid/filtered_iterator.h>
+
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/block_vector.h>
@@ -27,6 +31,9 @@
 #include <deal.II/lac/trilinos_parallel_block_vector.h>
 #include <deal.II/lac/trilinos_vector.h>
 
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
 #include <deal.II/numerics/vector_tools_rhs.h>
 
 
@@ -34,6 +41,112 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace VectorTools
 {
+  namespace internal
+  {
+    // Per-thread scratch object for the loops in create_right_hand_side()
+    // and create_boundary_right_hand_side() below. FEValuesType is either
+    // hp::FEValues or hp::FEFaceValues.
+    template <typename FEValuesType, typename Number>
+    struct RHSScratchData
+    {
+      RHSScratchData(const FEValuesType &x_fe_values)
+        : x_fe_values(x_fe_values)
+      {}
+
+      RHSScratchData(const RHSScratchData &scratch) = default;
+
+      FEValuesType                x_fe_values;
+      std::vector<Number>         rhs_values;
+      std::vector<Vector<Number>> rhs_vector_values;
+    };
+
+
+
+    // Copy object for the loops in create_right_hand_side() and
+    // create_boundary_right_hand_side(): the contribution of one cell and
+    // the indices of its degrees of freedom. The vector of indices is empty
+    // for cells that do not contribute.
+    template <typename Number>
+    struct RHSCopyData
+    {
+      Vector<Number>                       cell_vector;
+      std::vector<types::global_dof_index> dofs;
+    };
+
+
+
+    // Add the contribution of the cell or face that @p fe_values was last
+    // reinitialized with to @p cell_vector
+    template <typename FEValuesType, typename Number, int spacedim>
+    void
+    add_local_rhs(const FEValuesType               &fe_values,
+                  const Function<spacedim, Number> &rhs_function,
+                  std::vector<Number>              &rhs_values,
+                  std::vector<Vector<Number>>      &rhs_vector_values,
+                  Vector<Number>                   &cell_vector)
+    {
+      const auto        &fe            = fe_values.get_fe();
+      const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
+                         n_q_points    = fe_values.n_quadrature_points,
+                         n_components  = fe.n_components();
+
+      const std::vector<double> &weights = fe_values.get_JxW_values();
+
+      if (n_components == 1)
+        {
+          rhs_values.resize(n_q_points);
+          rhs_function.value_list(fe_values.get_quadrature_points(),
+                                  rhs_values);
+
+          for (unsigned int point = 0; point < n_q_points; ++point)
+            for (unsigned int i = 0; i < dofs_per_cell; ++i)
+              cell_vector(i) += rhs_values[point] *
+                                fe_values.shape_value(i, point) *
+                                weights[point];
+        }
+      else
+        {
+          rhs_vector_values.resize(n_q_points, Vector<Number>(n_components));
+          rhs_function.vector_value_list(fe_values.get_quadrature_points(),
+                                         rhs_vector_values);
+
+          // Use the faster code if the
+          // FiniteElement is primitive
+          if (fe.is_primitive())
+            {
+              for (unsigned int point = 0; point < n_q_points; ++point)
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  {
+                    const unsigned int component =
+                      fe.system_to_component_index(i).first;
+
+                    cell_vector(i) += rhs_vector_values[point](component) *
+                                      fe_values.shape_value(i, point) *
+                                      weights[point];
+                  }
+            }
+          else
+            {
+              // Otherwise do it the way proposed
+              // for vector valued elements
+              for (unsigned int point = 0; point < n_q_points; ++point)
+                for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                  for (unsigned int comp_i = 0; comp_i < n_components;
+                       ++comp_i)
+                    if (fe.get_nonzero_components(i)[comp_i])
+                      {
+                        cell_vector(i) +=
+                          rhs_vector_values[point](comp_i) *
+                          fe_values.shape_value_component(i, point, comp_i) *
+                          weights[point];
+                      }
+            }
+        }
+    }
+  } // namespace internal
+
+
+
   template <int dim, int spacedim, typename VectorType>
   DEAL_II_CXX20_REQUIRES(concepts::is_writable_dealii_vector_type<VectorType>)
   void create_boundary_right_hand_side(
@@ -44,114 +157,13 @@ namespace VectorTools
     VectorType                                                &rhs_vector,
     const std::set<types::boundary_id>                        &boundary_ids)
   {
-    const FiniteElement<dim> &fe = dof_handler.get_fe();
-    AssertDimension(fe.n_components(), rhs_function.n_components);
-    AssertDimension(rhs_vector.size(), dof_handler.n_dofs());
-
-    rhs_vector = typename VectorType::value_type(0.0);
-
-    UpdateFlags update_flags =
-      UpdateFlags(update_values | update_quadrature_points | update_JxW_values);
-    FEFaceValues<dim> fe_values(mapping, fe, quadrature, update_flags);
-
-    const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                       n_q_points    = fe_values.n_quadrature_points,
-                       n_components  = fe.n_components();
-
-    std::vector<types::global_dof_index> dofs(dofs_per_cell);
-    Vector<double>                       cell_vector(dofs_per_cell);
-
-    if (n_components == 1)
-      {
-        std::vector<double> rhs_values(n_q_points);
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          for (const unsigned int face : cell->face_indices())
-            if (cell->face(face)->at_boundary() &&
-                (boundary_ids.empty() ||
-                 (boundary_ids.find(cell->face(face)->boundary_id()) !=
-                  boundary_ids.end())))
-              {
-                fe_values.reinit(cell, face);
-
-                const std::vector<double> &weights = fe_values.get_JxW_values();
-                rhs_function.value_list(fe_values.get_quadrature_points(),
-                                        rhs_values);
-
-                cell_vector = 0;
-                for (unsigned int point = 0; point < n_q_points; ++point)
-                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                    cell_vector(i) += rhs_values[point] *
-                                      fe_values.shape_value(i, point) *
-                                      weights[point];
-
-                cell->get_dof_indices(dofs);
-
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  rhs_vector(dofs[i]) += cell_vector(i);
-              }
-      }
-    else
-      {
-        std::vector<Vector<double>> rhs_values(n_q_points,
-                                               Vector<double>(n_components));
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          for (const unsigned int face : cell->face_indices())
-            if (cell->face(face)->at_boundary() &&
-                (boundary_ids.empty() ||
-                 (boundary_ids.find(cell->face(face)->boundary_id()) !=
-                  boundary_ids.end())))
-              {
-                fe_values.reinit(cell, face);
-
-                const std::vector<double> &weights = fe_values.get_JxW_values();
-                rhs_function.vector_value_list(
-                  fe_values.get_quadrature_points(), rhs_values);
-
-                cell_vector = 0;
-
-                // Use the faster code if the
-                // FiniteElement is primitive
-                if (fe.is_primitive())
-                  {
-                    for (unsigned int point = 0; point < n_q_points; ++point)
-                      for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                        {
-                          const unsigned int component =
-                            fe.system_to_component_index(i).first;
-
-                          cell_vector(i) += rhs_values[point](component) *
-                                            fe_values.shape_value(i, point) *
-                                            weights[point];
-                        }
-                  }
-                else
-                  {
-                    // And the full featured
-                    // code, if vector valued
-                    // FEs are used
-                    for (unsigned int point = 0; point < n_q_points; ++point)
-                      for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                        for (unsigned int comp_i = 0; comp_i < n_components;
-                             ++comp_i)
-                          if (fe.get_nonzero_components(i)[comp_i])
-                            {
-                              cell_vector(i) +=
-                                rhs_values[point](comp_i) *
-                                fe_values.shape_value_component(i,
-                                                                point,
-                                                                comp_i) *
-                                weights[point];
-                            }
-                  }
-
-                cell->get_dof_indices(dofs);
-
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  rhs_vector(dofs[i]) += cell_vector(i);
-              }
-      }
+    create_boundary_right_hand_side(hp::MappingCollection<dim, spacedim>(
+                                      mapping),
+                                    dof_handler,
+                                    hp::QCollection<dim - 1>(quadrature),
+                                    rhs_function,
+                                    rhs_vector,
+                                    boundary_ids);
   }
 
 
@@ -185,6 +197,8 @@ namespace VectorTools
     VectorType                                                &rhs_vector,
     const std::set<types::boundary_id>                        &boundary_ids)
   {
+    using Number = typename VectorType::value_type;
+
     const hp::FECollection<dim> &fe = dof_handler.get_fe_collection();
     AssertDimension(fe.n_components(), rhs_function.n_components);
     AssertDimension(rhs_vector.size(), dof_handler.n_dofs());
@@ -193,118 +207,53 @@ namespace VectorTools
 
     UpdateFlags update_flags =
       UpdateFlags(update_values | update_quadrature_points | update_JxW_values);
-    hp::FEFaceValues<dim> x_fe_values(mapping, fe, quadrature, update_flags);
-
-    const unsigned int n_components = fe.n_components();
-
-    std::vector<types::global_dof_index> dofs(fe.max_dofs_per_cell());
-    Vector<double>                       cell_vector(fe.max_dofs_per_cell());
 
-    if (n_components == 1)
-      {
-        std::vector<double> rhs_values;
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          for (const unsigned int face : cell->face_indices())
-            if (cell->face(face)->at_boundary() &&
-                (boundary_ids.empty() ||
-                 (boundary_ids.find(cell->face(face)->boundary_id()) !=
-                  boundary_ids.end())))
-              {
-                x_fe_values.reinit(cell, face);
-
-                const FEFaceValues<dim> &fe_values =
-                  x_fe_values.get_present_fe_values();
-
-                const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                                   n_q_points = fe_values.n_quadrature_points;
-                rhs_values.resize(n_q_points);
-
-                const std::vector<double> &weights = fe_values.get_JxW_values();
-                rhs_function.value_list(fe_values.get_quadrature_points(),
-                                        rhs_values);
-
-                cell_vector = 0;
-                for (unsigned int point = 0; point < n_q_points; ++point)
-                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                    cell_vector(i) += rhs_values[point] *
-                                      fe_values.shape_value(i, point) *
-                                      weights[point];
-
-                dofs.resize(dofs_per_cell);
-                cell->get_dof_indices(dofs);
-
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  rhs_vector(dofs[i]) += cell_vector(i);
-              }
-      }
-    else
-      {
-        std::vector<Vector<double>> rhs_values;
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          for (const unsigned int face : cell->face_indices())
-            if (cell->face(face)->at_boundary() &&
-                (boundary_ids.empty() ||
-                 (boundary_ids.find(cell->face(face)->boundary_id()) !=
-                  boundary_ids.end())))
-              {
-                x_fe_values.reinit(cell, face);
-
-                const FEFaceValues<dim> &fe_values =
-                  x_fe_values.get_present_fe_values();
-
-                const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                                   n_q_points = fe_values.n_quadrature_points;
-                rhs_values.resize(n_q_points, Vector<double>(n_components));
-
-                const std::vector<double> &weights = fe_values.get_JxW_values();
-                rhs_function.vector_value_list(
-                  fe_values.get_quadrature_points(), rhs_values);
+    using CellIterator =
+      typename DoFHandler<dim, spacedim>::active_cell_iterator;
+    using ScratchData = internal::RHSScratchData<hp::FEFaceValues<dim>, Number>;
+    using CopyData    = internal::RHSCopyData<Number>;
+
+    // the faces of a cell are summed up on the cell, and the cells are
+    // handled in parallel. the contributions of the cells are added to the
+    // global vector sequentially
+    WorkStream::run(
+      dof_handler.begin_active(),
+      dof_handler.end(),
+      [&](const CellIterator &cell, ScratchData &scratch, CopyData &copy_data) {
+        copy_data.dofs.clear();
+
+        for (const unsigned int face : cell->face_indices())
+          if (cell->face(face)->at_boundary() &&
+              (boundary_ids.empty() ||
+               (boundary_ids.find(cell->face(face)->boundary_id()) !=
+                boundary_ids.end())))
+            {
+              scratch.x_fe_values.reinit(cell, face);
 
-                cell_vector = 0;
+              const FEFaceValues<dim> &fe_values =
+                scratch.x_fe_values.get_present_fe_values();
 
-                // Use the faster code if the
-                // FiniteElement is primitive
-                if (cell->get_fe().is_primitive())
-                  {
-                    for (unsigned int point = 0; point < n_q_points; ++point)
-                      for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                        {
-                          const unsigned int component =
-                            cell->get_fe().system_to_component_index(i).first;
-
-                          cell_vector(i) += rhs_values[point](component) *
-                                            fe_values.shape_value(i, point) *
-                                            weights[point];
-                        }
-                  }
-                else
-                  {
-                    // And the full featured
-                    // code, if vector valued
-                    // FEs are used
-                    for (unsigned int point = 0; point < n_q_points; ++point)
-                      for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                        for (unsigned int comp_i = 0; comp_i < n_components;
-                             ++comp_i)
-                          if (cell->get_fe().get_nonzero_components(i)[comp_i])
-                            {
-                              cell_vector(i) +=
-                                rhs_values[point](comp_i) *
-                                fe_values.shape_value_component(i,
-                                                                point,
-                                                                comp_i) *
-                                weights[point];
-                            }
-                  }
-                dofs.resize(dofs_per_cell);
-                cell->get_dof_indices(dofs);
+              if (copy_data.dofs.empty())
+                {
+                  copy_data.cell_vector.reinit(fe_values.dofs_per_cell);
+                  copy_data.dofs.resize(fe_values.dofs_per_cell);
+                  cell->get_dof_indices(copy_data.dofs);
+                }
 
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  rhs_vector(dofs[i]) += cell_vector(i);
-              }
-      }
+              internal::add_local_rhs(fe_values,
+                                      rhs_function,
+                                      scratch.rhs_values,
+                                      scratch.rhs_vector_values,
+                                      copy_data.cell_vector);
+            }
+      },
+      [&rhs_vector](const CopyData &copy_data) {
+        for (unsigned int i = 0; i < copy_data.dofs.size(); ++i)
+          rhs_vector(copy_data.dofs[i]) += copy_data.cell_vector(i);
+      },
+      ScratchData(
+        hp::FEFaceValues<dim>(mapping, fe, quadrature, update_flags)),
+      CopyData());
   }
 
 
@@ -339,109 +288,12 @@ namespace VectorTools
     VectorType                                                &rhs_vector,
     const AffineConstraints<typename VectorType::value_type>  &constraints)
   {
-    using Number = typename VectorType::value_type;
-
-    const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
-    AssertDimension(fe.n_components(), rhs_function.n_components);
-    AssertDimension(rhs_vector.size(), dof_handler.n_dofs());
-    rhs_vector = typename VectorType::value_type(0.0);
-
-    UpdateFlags update_flags =
-      UpdateFlags(update_values | update_quadrature_points | update_JxW_values);
-    FEValues<dim, spacedim> fe_values(mapping, fe, quadrature, update_flags);
-
-    const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                       n_q_points    = fe_values.n_quadrature_points,
-                       n_components  = fe.n_components();
-
-    std::vector<types::global_dof_index> dofs(dofs_per_cell);
-    Vector<Number>                       cell_vector(dofs_per_cell);
-
-    if (n_components == 1)
-      {
-        std::vector<Number> rhs_values(n_q_points);
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          if (cell->is_locally_owned())
-            {
-              fe_values.reinit(cell);
-
-              const std::vector<double> &weights = fe_values.get_JxW_values();
-              rhs_function.value_list(fe_values.get_quadrature_points(),
-                                      rhs_values);
-
-              cell_vector = 0;
-              for (unsigned int point = 0; point < n_q_points; ++point)
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  cell_vector(i) += rhs_values[point] *
-                                    fe_values.shape_value(i, point) *
-                                    weights[point];
-
-              cell->get_dof_indices(dofs);
-
-              constraints.distribute_local_to_global(cell_vector,
-                                                     dofs,
-                                                     rhs_vector);
-            }
-      }
-    else
-      {
-        std::vector<Vector<Number>> rhs_values(n_q_points,
-                                               Vector<Number>(n_components));
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          if (cell->is_locally_owned())
-            {
-              fe_values.reinit(cell);
-
-              const std::vector<double> &weights = fe_values.get_JxW_values();
-              rhs_function.vector_value_list(fe_values.get_quadrature_points(),
-                                             rhs_values);
-
-              cell_vector = 0;
-              // Use the faster code if the
-              // FiniteElement is primitive
-              if (fe.is_primitive())
-                {
-                  for (unsigned int point = 0; point < n_q_points; ++point)
-                    for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                      {
-                        const unsigned int component =
-                          fe.system_to_component_index(i).first;
-
-                        cell_vector(i) += rhs_values[point](component) *
-                                          fe_values.shape_value(i, point) *
-                                          weights[point];
-                      }
-                }
-              else
-                {
-                  // Otherwise do it the way
-                  // proposed for vector valued
-                  // elements
-                  for (unsigned int point = 0; point < n_q_points; ++point)
-                    for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                      for (unsigned int comp_i = 0; comp_i < n_components;
-                           ++comp_i)
-                        if (fe.get_nonzero_components(i)[comp_i])
-                          {
-                            cell_vector(i) +=
-                              rhs_values[point](comp_i) *
-                              fe_values.shape_value_component(i,
-                                                              point,
-                                                              comp_i) *
-                              weights[point];
-                          }
-                }
-              cell->get_dof_indices(dofs);
-
-              constraints.distribute_local_to_global(cell_vector,
-                                                     dofs,
-                                                     rhs_vector);
-            }
-      }
-
-    rhs_vector.compress(VectorOperation::values::add);
+    create_right_hand_side(hp::MappingCollection<dim, spacedim>(mapping),
+                           dof_handler,
+                           hp::QCollection<dim>(quadrature),
+                           rhs_function,
+                           rhs_vector,
+                           constraints);
   }
 
 
@@ -485,117 +337,43 @@ namespace VectorTools
 
     UpdateFlags update_flags =
       UpdateFlags(update_values | update_quadrature_points | update_JxW_values);
-    hp::FEValues<dim, spacedim> x_fe_values(mapping,
-                                            fe,
-                                            quadrature,
-                                            update_flags);
-
-    const unsigned int n_components = fe.n_components();
-
-    std::vector<types::global_dof_index> dofs(fe.max_dofs_per_cell());
-    Vector<Number>                       cell_vector(fe.max_dofs_per_cell());
 
-    if (n_components == 1)
-      {
-        std::vector<Number> rhs_values;
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          if (cell->is_locally_owned())
-            {
-              x_fe_values.reinit(cell);
-
-              const FEValues<dim, spacedim> &fe_values =
-                x_fe_values.get_present_fe_values();
-
-              const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                                 n_q_points    = fe_values.n_quadrature_points;
-              rhs_values.resize(n_q_points);
-              dofs.resize(dofs_per_cell);
-              cell_vector.reinit(dofs_per_cell);
-
-              const auto &weights = fe_values.get_JxW_values();
-              rhs_function.value_list(fe_values.get_quadrature_points(),
-                                      rhs_values);
-
-              cell_vector = 0;
-              for (unsigned int point = 0; point < n_q_points; ++point)
-                for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                  cell_vector(i) += rhs_values[point] *
-                                    fe_values.shape_value(i, point) *
-                                    weights[point];
-
-              cell->get_dof_indices(dofs);
-
-              constraints.distribute_local_to_global(cell_vector,
-                                                     dofs,
-                                                     rhs_vector);
-            }
-      }
-    else
-      {
-        std::vector<Vector<Number>> rhs_values;
-
-        for (const auto &cell : dof_handler.active_cell_iterators())
-          if (cell->is_locally_owned())
-            {
-              x_fe_values.reinit(cell);
-
-              const FEValues<dim, spacedim> &fe_values =
-                x_fe_values.get_present_fe_values();
-
-              const unsigned int dofs_per_cell = fe_values.dofs_per_cell,
-                                 n_q_points    = fe_values.n_quadrature_points;
-              rhs_values.resize(n_q_points, Vector<Number>(n_components));
-              dofs.resize(dofs_per_cell);
-              cell_vector.reinit(dofs_per_cell);
-
-              const auto &weights = fe_values.get_JxW_values();
-              rhs_function.vector_value_list(fe_values.get_quadrature_points(),
-                                             rhs_values);
-
-              cell_vector = 0;
-
-              // Use the faster code if the
-              // FiniteElement is primitive
-              if (cell->get_fe().is_primitive())
-                {
-                  for (unsigned int point = 0; point < n_q_points; ++point)
-                    for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                      {
-                        const unsigned int component =
-                          cell->get_fe().system_to_component_index(i).first;
-
-                        cell_vector(i) += rhs_values[point](component) *
-                                          fe_values.shape_value(i, point) *
-                                          weights[point];
-                      }
-                }
-              else
-                {
-                  // Otherwise do it the way proposed
-                  // for vector valued elements
-                  for (unsigned int point = 0; point < n_q_points; ++point)
-                    for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                      for (unsigned int comp_i = 0; comp_i < n_components;
-                           ++comp_i)
-                        if (cell->get_fe().get_nonzero_components(i)[comp_i])
-                          {
-                            cell_vector(i) +=
-                              rhs_values[point](comp_i) *
-                              fe_values.shape_value_component(i,
-                                                              point,
-                                                              comp_i) *
-                              weights[point];
-                          }
-                }
-
-              cell->get_dof_indices(dofs);
-
-              constraints.distribute_local_to_global(cell_vector,
-                                                     dofs,
-                                                     rhs_vector);
-            }
-      }
+    using ScratchData =
+      internal::RHSScratchData<hp::FEValues<dim, spacedim>, Number>;
+    using CopyData = internal::RHSCopyData<Number>;
+
+    // compute the contributions of the locally owned cells in parallel and
+    // add them to the global vector sequentially
+    using CellFilter = FilteredIterator<
+      typename DoFHandler<dim, spacedim>::active_cell_iterator>;
+    WorkStream::run(
+      CellFilter(IteratorFilters::LocallyOwnedCell(),
+                 dof_handler.begin_active()),
+      CellFilter(IteratorFilters::LocallyOwnedCell(), dof_handler.end()),
+      [&](const CellFilter &cell, ScratchData &scratch, CopyData &copy_data) {
+        scratch.x_fe_values.reinit(cell);
+
+        const FEValues<dim, spacedim> &fe_values =
+          scratch.x_fe_values.get_present_fe_values();
+
+        copy_data.cell_vector.reinit(fe_values.dofs_per_cell);
+        copy_data.dofs.resize(fe_values.dofs_per_cell);
+        cell->get_dof_indices(copy_data.dofs);
+
+        internal::add_local_rhs(fe_values,
+                                rhs_function,
+                                scratch.rhs_values,
+                                scratch.rhs_vector_values,
+                                copy_data.cell_vector);
+      },
+      [&](const CopyData &copy_data) {
+        constraints.distribute_local_to_global(copy_data.cell_vector,
+                                               copy_data.dofs,
+                                               rhs_vector);
+      },
+      ScratchData(
+        hp::FEValues<dim, spacedim>(mapping, fe, quadrature, update_flags)),
+      CopyData());
 
     rhs_vector.compress(VectorOperation::values::add);
   }
@@ -619,6 +397,68 @@ namespace VectorTools
       rhs_vector,
       constraints);
   }
+
+
+
+  template <int dim, typename Number>
+  void
+  create_right_hand_side(
+    const MatrixFree<dim, Number, VectorizedArray<Number>> &matrix_free,
+    const Function<dim, Number>                            &rhs_function,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> &rhs_vector,
+    const unsigned int                                             dof_no,
+    const unsigned int                                             quad_no)
+  {
+    using MatrixFreeType = MatrixFree<dim, Number, VectorizedArray<Number>>;
+    using VectorType     = LinearAlgebra::distributed::Vector<Number>;
+    using FEEval         = FEEvaluation<dim, -1, 0, 1, Number>;
+
+    const unsigned int n_components =
+      matrix_free.get_dof_handler(dof_no).get_fe_collection().n_components();
+    AssertDimension(n_components, rhs_function.n_components);
+
+    int dummy = 0;
+    matrix_free.template cell_loop<VectorType, int>(
+      [&](const MatrixFreeType                        &matrix_free,
+          VectorType                                  &dst,
+          const int                                   &,
+          const std::pair<unsigned int, unsigned int> &cell_range) {
+        // test the function with each vector component of the finite
+        // element separately
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            FEEval fe_eval(matrix_free, cell_range, dof_no, quad_no, c);
+            for (unsigned int cell = cell_range.first; cell < cell_range.second;
+                 ++cell)
+              {
+                fe_eval.reinit(cell);
+                const unsigned int n_filled_lanes =
+                  matrix_free.n_active_entries_per_cell_batch(cell);
+
+                for (const unsigned int q : fe_eval.quadrature_point_indices())
+                  {
+                    const Point<dim, VectorizedArray<Number>> p_vectorized =
+                      fe_eval.quadrature_point(q);
+
+                    VectorizedArray<Number> rhs_values(Number(0.));
+                    for (unsigned int v = 0; v < n_filled_lanes; ++v)
+                      {
+                        Point<dim> p;
+                        for (unsigned int d = 0; d < dim; ++d)
+                          p[d] = p_vectorized[d][v];
+                        rhs_values[v] = rhs_function.value(p, c);
+                      }
+                    fe_eval.submit_value(rhs_values, q);
+                  }
+
+                fe_eval.integrate_scatter(EvaluationFlags::values, dst);
+              }
+          }
+      },
+      rhs_vector,
+      dummy,
+      true);
+  }
 } // namespace VectorTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -595,6 +595,11 @@ namespace Particles
           particle_properties[i] = *pdata++;
       }
 
+    // See if there are property columns to load
+    if (property_pool->n_property_columns() > 0)
+      return property_pool->read_property_columns_from_memory(get_handle(),
+                                                              pdata);
+
     return static_cast<const void *>(pdata);
   }
 
@@ -629,6 +634,11 @@ namespace Particles
           *pdata = particle_properties[i];
       }
 
+    // Write property columns
+    if (property_pool->n_property_columns() > 0)
+      return property_pool->write_property_columns_to_memory(get_handle(),
+                                                             pdata);
+
     return static_cast<void *>(pdata);
   }
 
@@ -844,6 +854,7 @@ namespace Particles
       {
         size += sizeof(double) * get_properties().size();
       }
+    size += property_pool->property_columns_size_in_bytes();
     return size;
   }
 
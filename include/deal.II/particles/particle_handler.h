@@ -256,6 +256,27 @@ namespace Particles
       const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
       const;
 
+    /**
+     * Return a view to the values of the property column with index
+     * @p column (see PropertyPool::add_property_column()) for all particles
+     * that live on the given cell, in the order in which particles_in_cell()
+     * iterates over them. The returned array is contiguous in memory and can
+     * therefore be processed with vectorized loops, see the documentation of
+     * the PropertyPool class for an example.
+     *
+     * This function requires that the particles of the cell occupy
+     * consecutive memory slots, which is the case for locally owned cells
+     * after sort_particles_into_subdomains_and_cells(), but not necessarily
+     * after particles were inserted or removed individually. Ghost particles
+     * created by exchange_ghost_particles() are stored in whatever slots are
+     * free, so this function can in general not be used on ghost cells.
+     */
+    template <typename Number>
+    ArrayView<Number>
+    get_property_column_in_cell(
+      const unsigned int column,
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell);
+
     /**
      * Remove a particle pointed to by the iterator. Note that @p particle
      * and all iterators that point to other particles in the same cell
@@ -268,6 +289,8 @@ namespace Particles
      * Remove a vector of particles indicated by the particle iterators.
      * The iterators and all other particle iterators are invalidated
      * during the function call.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     void
     remove_particles(const std::vector<particle_iterator> &particles);
@@ -311,6 +334,8 @@ namespace Particles
      * This function involves a copy of the particles and their properties.
      * Note that this function is of O(n_existing_particles + n_particles)
      * complexity.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     void
     insert_particles(
@@ -326,6 +351,8 @@ namespace Particles
      * GridTools::compute_point_locations(), which assumes all positions are
      * within the local part of the triangulation. If one of them is not in the
      * local domain this function will throw an exception.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     void
     insert_particles(const std::vector<Point<spacedim>> &positions);
@@ -389,6 +416,8 @@ namespace Particles
      * of the points that were passed to this function on the calling mpi
      * process, and that falls within the part of triangulation owned by this
      * mpi process.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     std::map<unsigned int, IndexSet>
     insert_global_particles(
@@ -427,6 +456,8 @@ namespace Particles
      * of the points that were passed to this function on the calling mpi
      * process, and that falls within the part of triangulation owned by this
      * mpi process.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     std::map<unsigned int, IndexSet>
     insert_global_particles(
@@ -697,6 +728,59 @@ namespace Particles
     PropertyPool<dim, spacedim> &
     get_property_pool() const;
 
+    /**
+     * Sort the memory slots of the property pool in the order in which the
+     * particles are iterated over, i.e., cell by cell, starting with the
+     * locally owned particles and followed by the ghost particles, and
+     * release unused slots. Afterwards, loops over the particles of a cell
+     * access locations, properties, and property columns contiguously in
+     * memory.
+     *
+     * This function is called at the end of
+     * sort_particles_into_subdomains_and_cells(). If the automatic compaction
+     * was enabled with set_storage_compaction_threshold(), it is also called
+     * by remove_particles(), insert_particles(), insert_global_particles(),
+     * exchange_ghost_particles(), and
+     * unpack_after_coarsening_and_refinement().
+     *
+     * The compaction changes the numbers returned by
+     * ParticleAccessor::get_local_index() of all particles and the handles
+     * of their properties in the PropertyPool, so local indices and handles
+     * stored by user code are invalid afterwards. Particle iterators remain
+     * valid.
+     */
+    void
+    compact_particle_storage();
+
+    /**
+     * Set the threshold of the policy that decides when the particle storage
+     * is compacted automatically.
+     *
+     * Inserting and removing particles places them in unused slots of the
+     * property pool or leaves unused slots behind, so that the order of the
+     * particles in memory gradually deviates from the order of iteration.
+     * The class counts the number of particles inserted or removed since the
+     * storage was last compacted. Once this number exceeds @p threshold
+     * times the number of locally stored particles, insert_particles(),
+     * insert_global_particles(), remove_particles(), and
+     * exchange_ghost_particles() measure the fragmentation of the storage,
+     * defined as the fraction of particles whose slot does not directly
+     * follow the slot of the previous particle in iteration order plus the
+     * fraction of unused slots. If it exceeds @p threshold as well,
+     * compact_particle_storage() is called. The cost of the compaction is
+     * therefore amortized over a number of modifications proportional to
+     * the number of particles.
+     *
+     * Since compacting the storage changes the local indices of the
+     * particles and the handles of their properties, which user code may
+     * still hold, the automatic compaction is disabled by default, i.e., the
+     * threshold is `std::numeric_limits<double>::infinity()`. A value of 0.25
+     * is a reasonable choice to enable it. A value of zero compacts the
+     * storage whenever one of the functions above changed it.
+     */
+    void
+    set_storage_compaction_threshold(const double threshold);
+
     /**
      * Find and update the cells containing each particle for all locally owned
      * particles. If particles moved out of the local subdomain
@@ -718,6 +802,8 @@ namespace Particles
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
      * member variable.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     void
     exchange_ghost_particles(const bool enable_ghost_cache = false);
@@ -761,6 +847,8 @@ namespace Particles
      * calling this function after refinement would be similar to trying to
      * access a solution vector after mesh refinement without first using a
      * SolutionTransfer class to transfer the vector to the new mesh.
+     *
+     * @note May compact the particle storage, see compact_particle_storage().
      */
     void
     unpack_after_coarsening_and_refinement();
@@ -874,6 +962,25 @@ namespace Particles
     void
     reset_particle_container(particle_container &particles);
 
+    /**
+     * Remove the given particles from the particle container and release
+     * their memory slots, without compacting the storage afterwards. This is
+     * the part of remove_particles() that is also used in
+     * sort_particles_into_subdomains_and_cells(), which sorts the storage
+     * anyway.
+     */
+    void
+    remove_particles_without_compaction(
+      const std::vector<particle_iterator> &particles);
+
+    /**
+     * Call compact_particle_storage() if enough particles were inserted or
+     * removed since the last compaction and the storage is fragmented by
+     * more than storage_compaction_threshold.
+     */
+    void
+    compact_particle_storage_if_fragmented();
+
     /**
      * Address of the triangulation to work on.
      */
@@ -944,6 +1051,18 @@ namespace Particles
      */
     types::particle_index next_free_particle_index;
 
+    /**
+     * The threshold of the policy for compacting the particle storage, see
+     * set_storage_compaction_threshold().
+     */
+    double storage_compaction_threshold;
+
+    /**
+     * The number of particles that were inserted or removed since the
+     * particle storage was last compacted.
+     */
+    types::particle_index n_unsorted_storage_modifications;
+
     /**
      * A function that can be registered by calling
      * register_additional_store_load_functions. It is called when serializing
@@ -1361,6 +1480,43 @@ namespace Particles
       output_vector.compress(VectorOperation::insert);
   }
 
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  inline ArrayView<Number>
+  ParticleHandler<dim, spacedim>::get_property_column_in_cell(
+    const unsigned int column,
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+  {
+    AssertThrow(cell->is_artificial() == false,
+                ExcMessage("You can't ask for the particles on an artificial "
+                           "cell since we don't know what exists on these "
+                           "kinds of cells."));
+
+    if (cells_to_particle_cache.empty() ||
+        cells_to_particle_cache[cell->active_cell_index()] == particles.end())
+      return ArrayView<Number>();
+
+    const std::vector<typename PropertyPool<dim, spacedim>::Handle>
+      &handles = cells_to_particle_cache[cell->active_cell_index()]->particles;
+    if (handles.empty())
+      return ArrayView<Number>();
+
+    AssertThrow(handles.back() + 1 == handles.front() + handles.size(),
+                ExcMessage("The particles of this cell are not stored in "
+                           "consecutive memory slots. Call "
+                           "sort_particles_into_subdomains_and_cells() "
+                           "before accessing property columns per cell."));
+#ifdef DEBUG
+    for (unsigned int i = 1; i < handles.size(); ++i)
+      Assert(handles[i] == handles[i - 1] + 1, ExcInternalError());
+#endif
+
+    return property_pool->template get_property_column<Number>(
+      column, handles.front(), handles.size());
+  }
+
 } // namespace Particles
 
 DEAL_II_NAMESPACE_CLOSE
@@ -18,8 +18,13 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
 
+#include <type_traits>
+#include <variant>
+#include <vector>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -96,6 +101,46 @@ namespace Particles
    * course the PropertyType could contain a pointer to dynamically allocated
    * memory with varying sizes per particle (this memory would not be managed by
    * this class).
+   *
+   * <h3>Property columns</h3>
+   *
+   * The properties returned by get_properties() are stored particle by
+   * particle, i.e., all properties of one particle are adjacent in memory.
+   * Algorithms that only touch one out of many properties of each particle
+   * therefore load mostly data they do not need. For this case, the class
+   * additionally allows to store properties in a columnar layout: Each call
+   * to add_property_column() creates a separate array with one entry of type
+   * `double`, `float`, or `int` per slot, indexed by handles in the same way
+   * as the locations and the properties. The function get_property_column()
+   * gives access to the contiguous array of all slots or of a range of
+   * slots. Since ParticleHandler::sort_particles_into_subdomains_and_cells()
+   * sorts the memory slots in the order in which one iterates over the
+   * particles (see sort_memory_slots()), the particles of one locally owned
+   * cell afterwards occupy a contiguous range of slots, which
+   * ParticleHandler::get_property_column_in_cell() returns. This does not
+   * hold for particles that are added later, including the ghost particles
+   * created by ParticleHandler::exchange_ghost_particles(): they are stored
+   * in whatever slots are free at that time, i.e., in the holes left by
+   * removed particles and after the last used slot. A contiguous range can
+   * be processed with VectorizedArray:
+   * @code
+   *   const ArrayView<double> column =
+   *     particle_handler.get_property_column_in_cell<double>(column_index,
+   *                                                          cell);
+   *   const unsigned int n_lanes = VectorizedArray<double>::size();
+   *   unsigned int i = 0;
+   *   for (; i + n_lanes <= column.size(); i += n_lanes)
+   *     {
+   *       VectorizedArray<double> value;
+   *       value.load(column.data() + i);
+   *       value *= decay;
+   *       value.store(column.data() + i);
+   *     }
+   *   for (; i < column.size(); ++i)
+   *     column[i] *= decay;
+   * @endcode
+   * Property columns are transferred together with the other particle data
+   * when particles move between processes and during serialization.
    */
   template <int dim, int spacedim = dim>
   class PropertyPool
@@ -265,11 +310,82 @@ namespace Particles
      * container. This makes sure memory access is contiguous with actual
      * memory location. Because the ordering is given in the input argument
      * the complexity of this function is $O(N)$ where $N$ is the number of
-     * elements in the input argument.
+     * elements in the input argument. The data is permuted in parallel if
+     * multithreading is enabled.
      */
     void
     sort_memory_slots(const std::vector<Handle> &handles_to_sort);
 
+    /**
+     * Add a property column with one value of type @p Number per slot. The
+     * supported types are `double`, `float`, and `int`. All existing slots
+     * are initialized with zero. Return the index of the new column, to be
+     * used in get_property_column().
+     */
+    template <typename Number>
+    unsigned int
+    add_property_column();
+
+    /**
+     * Return the number of property columns added via
+     * add_property_column().
+     */
+    unsigned int
+    n_property_columns() const;
+
+    /**
+     * Return a view to the values of the property column with index
+     * @p column for all slots of the pool, indexed by handles. The handle
+     * of a particle is returned by ParticleAccessor::get_local_index().
+     * @p Number must be the type the column was created with.
+     */
+    template <typename Number>
+    ArrayView<Number>
+    get_property_column(const unsigned int column);
+
+    /**
+     * Same as above, but for read-only access.
+     */
+    template <typename Number>
+    ArrayView<const Number>
+    get_property_column(const unsigned int column) const;
+
+    /**
+     * Return a view to the values of the property column with index
+     * @p column for the @p n_handles consecutive slots starting at
+     * @p first_handle.
+     */
+    template <typename Number>
+    ArrayView<Number>
+    get_property_column(const unsigned int column,
+                        const Handle       first_handle,
+                        const unsigned int n_handles);
+
+    /**
+     * Return the number of bytes that write_property_columns_to_memory()
+     * writes for one slot. The number is rounded up to a multiple of
+     * `sizeof(double)` so that data following it stays aligned.
+     */
+    std::size_t
+    property_columns_size_in_bytes() const;
+
+    /**
+     * Write the values of all property columns for the slot @p handle to
+     * the memory location @p data and return a pointer to the first byte
+     * after the written data.
+     */
+    void *
+    write_property_columns_to_memory(const Handle handle, void *data) const;
+
+    /**
+     * Read the values of all property columns for the slot @p handle from
+     * the memory location @p data, written by
+     * write_property_columns_to_memory(), and return a pointer to the first
+     * byte after the read data.
+     */
+    const void *
+    read_property_columns_from_memory(const Handle handle, const void *data);
+
   private:
     /**
      * The number of properties that are reserved per particle.
@@ -304,6 +420,18 @@ namespace Particles
      */
     std::vector<double> properties;
 
+    /**
+     * The type used to store one property column.
+     */
+    using PropertyColumn =
+      std::variant<std::vector<double>, std::vector<float>, std::vector<int>>;
+
+    /**
+     * The property columns added via add_property_column(). Each column is
+     * indexed the same way as the `locations` array via handles.
+     */
+    std::vector<PropertyColumn> property_columns;
+
     /**
      * A collection of handles that have been created by
      * allocate_properties_array() and have been destroyed by
@@ -497,6 +625,87 @@ namespace Particles
   }
 
 
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  inline unsigned int
+  PropertyPool<dim, spacedim>::add_property_column()
+  {
+    static_assert(std::is_same_v<Number, double> ||
+                    std::is_same_v<Number, float> ||
+                    std::is_same_v<Number, int>,
+                  "Property columns can only store double, float, or int.");
+
+    property_columns.emplace_back(std::vector<Number>(locations.size()));
+    return property_columns.size() - 1;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  PropertyPool<dim, spacedim>::n_property_columns() const
+  {
+    return property_columns.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  inline ArrayView<Number>
+  PropertyPool<dim, spacedim>::get_property_column(const unsigned int column)
+  {
+    AssertIndexRange(column, property_columns.size());
+    std::vector<Number> *values =
+      std::get_if<std::vector<Number>>(&property_columns[column]);
+    Assert(values != nullptr,
+           ExcMessage("The property column was created with a different "
+                      "value type than the one requested."));
+
+    return ArrayView<Number>(values->data(), values->size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  inline ArrayView<const Number>
+  PropertyPool<dim, spacedim>::get_property_column(
+    const unsigned int column) const
+  {
+    AssertIndexRange(column, property_columns.size());
+    const std::vector<Number> *values =
+      std::get_if<std::vector<Number>>(&property_columns[column]);
+    Assert(values != nullptr,
+           ExcMessage("The property column was created with a different "
+                      "value type than the one requested."));
+
+    return ArrayView<const Number>(values->data(), values->size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Number>
+  inline ArrayView<Number>
+  PropertyPool<dim, spacedim>::get_property_column(
+    const unsigned int column,
+    const Handle       first_handle,
+    const unsigned int n_handles)
+  {
+    if (n_handles == 0)
+      return ArrayView<Number>();
+
+    const ArrayView<Number> values = get_property_column<Number>(column);
+    Assert(first_handle != invalid_handle &&
+             std::size_t(first_handle) + n_handles <= values.size(),
+           ExcMessage("Invalid range of property handles."));
+
+    return ArrayView<Number>(values.data() + first_handle, n_handles);
+  }
+
+
 } // namespace Particles
 
 DEAL_II_NAMESPACE_CLOSE
@@ -101,10 +101,23 @@ namespace Utilities
       const GridTools::Cache<dim, spacedim> &cache,
       const std::vector<Point<spacedim>>    &points)
     {
+      this->search_and_reinit(cache, points, false);
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    RemotePointEvaluation<dim, spacedim>::search_and_reinit(
+      const GridTools::Cache<dim, spacedim> &cache,
+      const std::vector<Point<spacedim>>    &points,
+      const bool                             keep_point_locations)
+    {
 #ifndef DEAL_II_WITH_MPI
       Assert(false, ExcNeedsMPI());
       (void)cache;
       (void)points;
+      (void)keep_point_locations;
 #else
       if (tria_signal.connected())
         tria_signal.disconnect();
@@ -118,18 +131,23 @@ namespace Utilities
         extract_rtree_level(cache.get_locally_owned_cell_bounding_boxes_rtree(),
                             additional_data.rtree_level));
 
-      const auto data =
-        GridTools::internal::distributed_compute_point_locations(
-          cache,
-          points,
-          global_bboxes,
-          additional_data.marked_vertices ? additional_data.marked_vertices() :
-                                            std::vector<bool>(),
-          additional_data.tolerance,
-          true,
-          additional_data.enforce_unique_mapping);
+      auto data = GridTools::internal::distributed_compute_point_locations(
+        cache,
+        points,
+        global_bboxes,
+        additional_data.marked_vertices ? additional_data.marked_vertices() :
+                                          std::vector<bool>(),
+        additional_data.tolerance,
+        true,
+        additional_data.enforce_unique_mapping);
 
       this->reinit(data, cache.get_triangulation(), cache.get_mapping());
+
+      if (keep_point_locations)
+        this->point_locations = std::make_unique<
+          GridTools::internal::DistributedComputePointLocationsInternal<
+            dim,
+            spacedim>>(std::move(data));
 #endif
     }
 
@@ -146,6 +164,8 @@ namespace Utilities
       this->tria    = &tria;
       this->mapping = &mapping;
 
+      this->point_locations.reset();
+
       this->recv_ranks = data.recv_ranks;
       this->recv_ptrs  = data.recv_ptrs;
 
@@ -266,6 +286,200 @@ namespace Utilities
 
 
 
+    template <int dim, int spacedim>
+    void
+    RemotePointEvaluation<dim, spacedim>::reinit_incremental(
+      const GridTools::Cache<dim, spacedim> &cache,
+      const std::vector<Point<spacedim>>    &points)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)cache;
+      (void)points;
+#else
+      const MPI_Comm comm = cache.get_triangulation().get_communicator();
+
+      // points that are not found are searched again anyway, but each point
+      // that is found has to be associated with a single cell
+      bool can_update =
+        ready_flag && point_locations != nullptr &&
+        tria == &cache.get_triangulation() && mapping == &cache.get_mapping() &&
+        points.size() == point_locations->n_searched_points;
+      for (unsigned int i = 0; can_update && i < points.size(); ++i)
+        if (point_ptrs[i + 1] - point_ptrs[i] > 1)
+          can_update = false;
+      if (Utilities::MPI::min(can_update ? 1U : 0U, comm) == 0)
+        {
+          this->search_and_reinit(cache, points, true);
+          return;
+        }
+
+      // take the data out of this object, since reinit() below discards the
+      // stored point locations
+      auto data = std::move(*point_locations);
+      point_locations.reset();
+
+      // send the new positions of the points to the processes that
+      // evaluated them so far
+      std::map<unsigned int,
+               std::vector<std::pair<unsigned int, Point<spacedim>>>>
+        moved_points_to_send;
+      for (const auto &[rank, index, enumeration] : data.recv_components)
+        moved_points_to_send[rank].emplace_back(index, points[index]);
+      const auto moved_points =
+        Utilities::MPI::some_to_some(comm, moved_points_to_send);
+
+      const auto locate = [&](const auto            &cell,
+                              const Point<spacedim> &point,
+                              Point<dim>            &reference_point) {
+        try
+          {
+            const Point<dim> unit_point =
+              mapping->transform_real_to_unit_cell(cell, point);
+            if (cell->reference_cell().contains_point(
+                  unit_point, additional_data.tolerance))
+              {
+                reference_point = unit_point;
+                return true;
+              }
+          }
+        catch (typename Mapping<dim, spacedim>::ExcTransformationFailed &)
+          {}
+        return false;
+      };
+
+      // look for each point in its previous cell and in the locally owned
+      // cells that share a vertex with that cell; the points not found there
+      // are reported back to their owners
+      const auto &vertex_to_cells = cache.get_vertex_to_cell_map();
+
+      decltype(data.send_components) send_components;
+      send_components.reserve(data.send_components.size());
+      std::map<unsigned int, std::vector<unsigned int>> lost_points_to_send;
+      for (auto component : data.send_components)
+        {
+          auto &[cell_id, rank, index, reference_point, point, enumeration] =
+            component;
+
+          const auto &candidates = moved_points.at(rank);
+          const auto  moved_point =
+            std::lower_bound(candidates.begin(),
+                            candidates.end(),
+                            index,
+                            [](const auto &a, const unsigned int b) {
+                              return a.first < b;
+                            });
+          Assert(moved_point != candidates.end() &&
+                   moved_point->first == index,
+                 ExcInternalError());
+          point = moved_point->second;
+
+          const typename Triangulation<dim, spacedim>::active_cell_iterator
+               cell(tria.get(), cell_id.first, cell_id.second);
+          bool found = locate(cell, point, reference_point);
+          for (unsigned int v = 0; v < cell->n_vertices() && !found; ++v)
+            for (const auto &neighbor : vertex_to_cells[cell->vertex_index(v)])
+              if (neighbor != cell && neighbor->is_locally_owned() &&
+                  locate(neighbor, point, reference_point))
+                {
+                  cell_id = {neighbor->level(), neighbor->index()};
+                  found   = true;
+                  break;
+                }
+
+          if (found)
+            send_components.push_back(component);
+          else
+            lost_points_to_send[rank].push_back(index);
+        }
+
+      const auto lost_points =
+        Utilities::MPI::some_to_some(comm, lost_points_to_send);
+
+      // search again for the lost points and for the points that have not
+      // been found before
+      std::vector<bool> search_again(points.size(), true);
+      for (const auto &component : data.recv_components)
+        search_again[std::get<1>(component)] = false;
+      for (const auto &[rank, indices] : lost_points)
+        for (const unsigned int index : indices)
+          search_again[index] = true;
+
+      decltype(data.recv_components) recv_components;
+      recv_components.reserve(data.recv_components.size());
+      for (const auto &component : data.recv_components)
+        if (search_again[std::get<1>(component)] == false)
+          recv_components.push_back(component);
+
+      std::vector<unsigned int>    search_indices;
+      std::vector<Point<spacedim>> search_points;
+      for (unsigned int i = 0; i < points.size(); ++i)
+        if (search_again[i])
+          {
+            search_indices.push_back(i);
+            search_points.push_back(points[i]);
+          }
+
+      if (Utilities::MPI::max(static_cast<unsigned int>(search_points.size()),
+                              comm) > 0)
+        {
+          std::vector<std::vector<BoundingBox<spacedim>>> global_bboxes;
+          global_bboxes.emplace_back(extract_rtree_level(
+            cache.get_locally_owned_cell_bounding_boxes_rtree(),
+            additional_data.rtree_level));
+
+          const auto search_data =
+            GridTools::internal::distributed_compute_point_locations(
+              cache,
+              search_points,
+              global_bboxes,
+              additional_data.marked_vertices ?
+                additional_data.marked_vertices() :
+                std::vector<bool>(),
+              additional_data.tolerance,
+              true,
+              additional_data.enforce_unique_mapping);
+
+          // the search enumerates the points of each process by their
+          // position in the list of searched points, so translate this
+          // position back to the index of the point, on the owning process
+          // directly and on the evaluating processes after sending them the
+          // list of indices
+          for (auto component : search_data.recv_components)
+            {
+              std::get<1>(component) = search_indices[std::get<1>(component)];
+              recv_components.push_back(component);
+            }
+
+          std::map<unsigned int, std::vector<unsigned int>> indices_to_send;
+          for (const unsigned int rank : search_data.recv_ranks)
+            indices_to_send[rank] = search_indices;
+          const auto received_indices =
+            Utilities::MPI::some_to_some(comm, indices_to_send);
+
+          for (auto component : search_data.send_components)
+            {
+              std::get<2>(component) = received_indices.at(
+                std::get<1>(component))[std::get<2>(component)];
+              send_components.push_back(component);
+            }
+        }
+
+      data.send_components = std::move(send_components);
+      data.recv_components = std::move(recv_components);
+      data.finalize_setup();
+
+      this->reinit(data, *tria, *mapping);
+
+      this->point_locations = std::make_unique<
+        GridTools::internal::DistributedComputePointLocationsInternal<
+          dim,
+          spacedim>>(std::move(data));
+#endif
+    }
+
+
+
     template <int dim, int spacedim>
     RemotePointEvaluation<dim, spacedim>::CellData::CellData(
       const Triangulation<dim, spacedim> &triangulation)
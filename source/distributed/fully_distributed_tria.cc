@@ -322,15 +322,21 @@ namespace parallel
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::repartition()
     {
+      const auto partition = this->partitioner_distributed->partition(*this);
+
+      // an empty vector means that the current partition is kept, in which
+      // case there is nothing to do
+      if (partition.size() == 0)
+        return;
+
       // signal that repartitioning has started
       this->signals.pre_distributed_repartition();
 
       // create construction_data with the help of the partitioner
       const auto construction_data = TriangulationDescription::Utilities::
-        create_description_from_triangulation(
-          *this,
-          this->partitioner_distributed->partition(*this),
-          this->settings);
+        create_description_from_triangulation(*this,
+                                              partition,
+                                              this->settings);
 
       // clear old content
       this->clear();
@@ -15,12 +15,18 @@
 
 #include <deal.II/base/mpi_compute_index_owner_internal.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/repartitioning_policy_tools.h>
 #include <deal.II/distributed/tria_base.h>
 
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -323,6 +329,316 @@ namespace RepartitioningPolicyTools
   }
 
 
+
+  template <int dim, int spacedim>
+  SpaceFillingCurvePolicy<dim, spacedim>::SpaceFillingCurvePolicy(
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)> &weighting_function)
+    : weighting_function(weighting_function)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  SpaceFillingCurvePolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto partitioner =
+      tria->global_active_cell_index_partitioner().lock();
+
+    const auto mpi_communicator = tria_in.get_communicator();
+    const auto n_subdomains = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    // step 1) determine the centers and weights of the locally owned cells,
+    // sorted by their local index
+    std::vector<Point<spacedim>> centers(partitioner->locally_owned_size());
+    std::vector<std::uint64_t>   weights(partitioner->locally_owned_size(), 1);
+
+    for (const auto &cell :
+         tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+      {
+        const unsigned int i =
+          partitioner->global_to_local(cell->global_active_cell_index());
+        centers[i] = cell->center();
+        if (weighting_function)
+          weights[i] = weighting_function(cell, CellStatus::cell_will_persist);
+      }
+
+    // step 2) compute the index of each center along a Hilbert curve through
+    // the bounding box of all cells; the curve index is packed into a single
+    // integer so that it can be used in a bisection below
+    std::array<double, spacedim> local_lower, local_upper;
+    local_lower.fill(std::numeric_limits<double>::max());
+    local_upper.fill(std::numeric_limits<double>::lowest());
+    for (const auto &center : centers)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          local_lower[d] = std::min(local_lower[d], center[d]);
+          local_upper[d] = std::max(local_upper[d], center[d]);
+        }
+    std::array<double, spacedim> lower_left, upper_right;
+    Utilities::MPI::min(local_lower, mpi_communicator, lower_left);
+    Utilities::MPI::max(local_upper, mpi_communicator, upper_right);
+
+    std::pair<Point<spacedim>, Point<spacedim>> bounding_box;
+    for (unsigned int d = 0; d < spacedim; ++d)
+      {
+        bounding_box.first[d]  = lower_left[d];
+        bounding_box.second[d] = upper_right[d];
+      }
+
+    std::vector<std::uint64_t> hilbert_keys(centers.size());
+    GridTools::internal::compute_hilbert_keys<spacedim>(
+      centers, BoundingBox<spacedim>(bounding_box), hilbert_keys);
+
+    // sort the keys, and accumulate the weights in the sorted order, so that
+    // the weight of all local cells with a key less than a given value can
+    // be determined by a binary search
+    std::vector<std::pair<std::uint64_t, unsigned int>> keys(centers.size());
+    for (unsigned int i = 0; i < keys.size(); ++i)
+      keys[i] = {hilbert_keys[i], i};
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<std::uint64_t> weight_sums(keys.size() + 1, 0);
+    for (unsigned int i = 0; i < keys.size(); ++i)
+      weight_sums[i + 1] = weight_sums[i] + weights[keys[i].second];
+
+    const auto local_weight_below = [&](const std::uint64_t key) {
+      const auto it =
+        std::lower_bound(keys.begin(),
+                         keys.end(),
+                         key,
+                         [](const auto &entry, const std::uint64_t key) {
+                           return entry.first < key;
+                         });
+      return weight_sums[it - keys.begin()];
+    };
+
+    const std::uint64_t total_weight =
+      Utilities::MPI::sum(weight_sums.back(), mpi_communicator);
+
+    // step 3) determine the n_subdomains-1 cuts of the curve: cut k is the
+    // smallest key such that the total weight of the cells with smaller keys
+    // is at least k/n_subdomains of the total weight. All cuts are determined
+    // at once by a bisection over the key range, which requires one global
+    // reduction per bit of the keys.
+    const unsigned int         n_cuts = n_subdomains - 1;
+    std::vector<std::uint64_t> lower(n_cuts, 0);
+    std::vector<std::uint64_t> upper(
+      n_cuts,
+      std::uint64_t(1)
+        << (GridTools::internal::hilbert_key_bits_per_dim<spacedim> *
+            spacedim));
+    std::vector<std::uint64_t> local_weights(n_cuts);
+    std::vector<std::uint64_t> global_weights(n_cuts);
+
+    while (lower != upper)
+      {
+        for (unsigned int k = 0; k < n_cuts; ++k)
+          local_weights[k] =
+            local_weight_below(lower[k] + (upper[k] - lower[k]) / 2);
+
+        Utilities::MPI::sum(local_weights, mpi_communicator, global_weights);
+
+        for (unsigned int k = 0; k < n_cuts; ++k)
+          if (lower[k] < upper[k])
+            {
+              const std::uint64_t middle = lower[k] + (upper[k] - lower[k]) / 2;
+              if (global_weights[k] * n_subdomains >= (k + 1) * total_weight)
+                upper[k] = middle;
+              else
+                lower[k] = middle + 1;
+            }
+      }
+
+    // step 4) a cell belongs to the subdomain given by the number of cuts
+    // that are not larger than its key
+    LinearAlgebra::distributed::Vector<double> partition(partitioner);
+
+    for (const auto &[key, i] : keys)
+      partition.local_element(i) =
+        std::upper_bound(lower.begin(), lower.end(), key) - lower.begin();
+
+    return partition;
+#endif
+  }
+
+
+
+  template <int dim, int spacedim>
+  MeasuredCostPolicy<dim, spacedim>::MeasuredCostPolicy(
+    const double imbalance_threshold,
+    const double hysteresis,
+    const double smoothing)
+    : imbalance_threshold(imbalance_threshold)
+    , hysteresis(hysteresis)
+    , smoothing(smoothing)
+    , imbalance(1.)
+    , reference_imbalance(0.)
+    , measure_reference_imbalance(false)
+  {
+    Assert(imbalance_threshold >= 1.,
+           ExcMessage("The imbalance threshold must be at least one."));
+    Assert(hysteresis >= 0.,
+           ExcMessage("The hysteresis must not be negative."));
+    Assert(smoothing > 0. && smoothing <= 1.,
+           ExcMessage("The smoothing factor must be in (0,1]."));
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  MeasuredCostPolicy<dim, spacedim>::add_cell_cost(const CellId &cell_id,
+                                                   const double  cost)
+  {
+    Assert(cost >= 0., ExcMessage("Costs must not be negative."));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    current_costs[cell_id] += cost;
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  MeasuredCostPolicy<dim, spacedim>::get_imbalance() const
+  {
+    return imbalance;
+  }
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  MeasuredCostPolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto partitioner =
+      tria->global_active_cell_index_partitioner().lock();
+
+    const auto mpi_communicator = tria_in.get_communicator();
+    const auto n_subdomains = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    // step 1) merge the costs of the current period into the running
+    // averages
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (const auto &[cell_id, cost] : current_costs)
+        {
+          const auto [it, inserted] = smoothed_costs.emplace(cell_id, cost);
+          if (inserted == false)
+            it->second = smoothing * cost + (1. - smoothing) * it->second;
+        }
+      current_costs.clear();
+    }
+
+    // step 2) determine the cost of each locally owned cell. Cells without
+    // measurement (marked by a negative cost) get the average cost. Entries
+    // of cells that are no longer active and locally owned are dropped.
+    std::vector<double>      costs(partitioner->locally_owned_size(), -1.);
+    std::map<CellId, double> costs_of_owned_cells;
+    double                   measured_cost    = 0.;
+    unsigned int             n_measured_cells = 0;
+
+    for (const auto &cell :
+         tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+      {
+        const auto it = smoothed_costs.find(cell->id());
+        if (it != smoothed_costs.end())
+          {
+            costs[partitioner->global_to_local(
+              cell->global_active_cell_index())] = it->second;
+            costs_of_owned_cells.insert(*it);
+            measured_cost += it->second;
+            ++n_measured_cells;
+          }
+      }
+    smoothed_costs.swap(costs_of_owned_cells);
+
+    // the average cost of the measured cells of all processes. If no cell
+    // has been measured yet, all cells get the same cost, so that the
+    // value does not matter.
+    const double global_measured_cost =
+      Utilities::MPI::sum(measured_cost, mpi_communicator);
+    const types::global_cell_index n_global_measured_cells =
+      Utilities::MPI::sum<types::global_cell_index>(n_measured_cells,
+                                                    mpi_communicator);
+    const double average_cost =
+      n_global_measured_cells > 0 ?
+        global_measured_cost / n_global_measured_cells :
+        1.;
+    for (double &cost : costs)
+      if (cost < 0.)
+        cost = average_cost;
+
+    // step 3) determine the load imbalance and decide whether the cells
+    // should be repartitioned
+    const double process_local_cost =
+      std::accumulate(costs.begin(), costs.end(), 0.);
+
+    const auto [process_local_cost_offset, total_cost] =
+      Utilities::MPI::partial_and_total_sum(process_local_cost,
+                                            mpi_communicator);
+    const double max_cost =
+      Utilities::MPI::max(process_local_cost, mpi_communicator);
+
+    imbalance = total_cost > 0. ? max_cost * n_subdomains / total_cost : 1.;
+
+    if (measure_reference_imbalance)
+      {
+        reference_imbalance         = imbalance;
+        measure_reference_imbalance = false;
+      }
+
+    if (imbalance <= imbalance_threshold ||
+        imbalance <= reference_imbalance + hysteresis)
+      return {}; // keep the current partition
+
+    measure_reference_imbalance = true;
+
+    // step 4) set up a partition with equal costs per process, in the same
+    // way as CellWeightPolicy
+    LinearAlgebra::distributed::Vector<double> partition(partitioner);
+
+    double cost = process_local_cost_offset;
+    for (unsigned int i = 0; i < partition.locally_owned_size(); ++i)
+      {
+        partition.local_element(i) = std::min<unsigned int>(
+          static_cast<unsigned int>(cost * n_subdomains / total_cost),
+          n_subdomains - 1);
+        cost += costs[i];
+      }
+
+    return partition;
+#endif
+  }
+
+
 } // namespace RepartitioningPolicyTools
 
 
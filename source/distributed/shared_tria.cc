@@ -53,14 +53,15 @@ namespace parallel
     {
       const auto partition_settings =
         (partition_zoltan | partition_metis | partition_zorder |
-         partition_custom_signal) &
+         partition_custom_signal | partition_hilbert) &
         settings;
       (void)partition_settings;
       Assert(partition_settings == partition_auto ||
                partition_settings == partition_metis ||
                partition_settings == partition_zoltan ||
                partition_settings == partition_zorder ||
-               partition_settings == partition_custom_signal,
+               partition_settings == partition_custom_signal ||
+               partition_settings == partition_hilbert,
              ExcMessage("Settings must contain exactly one type of the active "
                         "cell partitioning scheme."));
 
@@ -99,9 +100,10 @@ namespace parallel
           "agree on the number of active cells."));
 #  endif
 
-      auto partition_settings = (partition_zoltan | partition_metis |
-                                 partition_zorder | partition_custom_signal) &
-                                settings;
+      auto partition_settings =
+        (partition_zoltan | partition_metis | partition_zorder |
+         partition_custom_signal | partition_hilbert) &
+        settings;
       if (partition_settings == partition_auto)
 #  ifdef DEAL_II_TRILINOS_WITH_ZOLTAN
         partition_settings = partition_zoltan;
@@ -146,6 +148,28 @@ namespace parallel
         {
           GridTools::partition_triangulation_zorder(this->n_subdomains, *this);
         }
+      else if (partition_settings == partition_hilbert)
+        {
+          // get the cell weights if a signal has been attached to the
+          // triangulation, in the same way as partition_triangulation()
+          // does for the other partitioners
+          std::vector<unsigned int> cell_weights;
+          if (!this->signals.weight.empty())
+            {
+              cell_weights.resize(this->n_active_cells(), 0U);
+              for (const auto &cell : this->active_cell_iterators() |
+                                        IteratorFilters::LocallyOwnedCell())
+                cell_weights[cell->active_cell_index()] =
+                  this->signals.weight(cell, CellStatus::cell_will_persist);
+              Utilities::MPI::sum(cell_weights,
+                                  this->get_communicator(),
+                                  cell_weights);
+            }
+
+          GridTools::partition_triangulation_hilbert(this->n_subdomains,
+                                                     *this,
+                                                     cell_weights);
+        }
       else if (partition_settings == partition_custom_signal)
         {
           // User partitions mesh manually
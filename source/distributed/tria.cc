@@ -2071,9 +2071,11 @@ namespace parallel
         {
           std::string   fname = file_basename + ".info";
           std::ofstream f(fname);
+          // Checkpoints with the indexed layout of the fixed size data are
+          // marked by a separate version number.
           f << "version nproc n_attached_fixed_size_objs n_attached_variable_size_objs n_coarse_cells"
             << std::endl
-            << 5 << " "
+            << ((settings & indexed_checkpoints) ? 6 : 5) << " "
             << Utilities::MPI::n_mpi_processes(this->mpi_communicator) << " "
             << this->cell_attached_data.pack_callbacks_fixed.size() << " "
             << this->cell_attached_data.pack_callbacks_variable.size() << " "
@@ -2092,7 +2094,8 @@ namespace parallel
       // Save cell attached data.
       this->save_attached_data(parallel_forest->global_first_quadrant[myrank],
                                parallel_forest->global_num_quadrants,
-                               file_basename);
+                               file_basename,
+                               (settings & indexed_checkpoints) != 0);
 
       dealii::internal::p4est::functions<dim>::save(file_basename.c_str(),
                                                     parallel_forest,
@@ -2107,6 +2110,28 @@ namespace parallel
     template <int dim, int spacedim>
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     void Triangulation<dim, spacedim>::load(const std::string &file_basename)
+    {
+      load_implementation(file_basename, {});
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::load(
+      const std::string               &file_basename,
+      const std::vector<unsigned int> &fixed_size_attachments)
+    {
+      load_implementation(file_basename, fixed_size_attachments);
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::load_implementation(
+      const std::string                              &file_basename,
+      const std::optional<std::vector<unsigned int>> &fixed_size_attachments)
     {
       Assert(
         this->n_cells() > 0,
@@ -2147,16 +2172,41 @@ namespace parallel
           attached_count_variable >> n_coarse_cells;
       }
 
-      AssertThrow(version == 5,
+      AssertThrow(version == 5 || version == 6,
                   ExcMessage("Incompatible version found in .info file."));
       Assert(this->n_cells(0) == n_coarse_cells,
              ExcMessage("Number of coarse cells differ!"));
 
+      // Version 6 denotes the indexed layout of the fixed size data, which
+      // is the only one that allows to select individual fields.
+      const bool indexed_layout = (version == 6);
+      AssertThrow(indexed_layout || !fixed_size_attachments.has_value(),
+                  ExcMessage("Loading only selected attachments requires a "
+                             "checkpoint written with the "
+                             "Settings::indexed_checkpoints flag."));
+
+      std::vector<unsigned int> fixed_size_attachments_to_load;
+      if (fixed_size_attachments.has_value())
+        fixed_size_attachments_to_load = *fixed_size_attachments;
+      else
+        {
+          fixed_size_attachments_to_load.resize(attached_count_fixed);
+          std::iota(fixed_size_attachments_to_load.begin(),
+                    fixed_size_attachments_to_load.end(),
+                    0u);
+        }
+      for (const unsigned int i : fixed_size_attachments_to_load)
+        AssertThrow(i < attached_count_fixed,
+                    ExcMessage("The checkpoint only contains " +
+                               std::to_string(attached_count_fixed) +
+                               " fixed size attachments, but attachment " +
+                               std::to_string(i) + " was requested."));
+
       // clear all of the callback data, as explained in the documentation of
       // register_data_attach()
       this->cell_attached_data.n_attached_data_sets = 0;
       this->cell_attached_data.n_attached_deserialize =
-        attached_count_fixed + attached_count_variable;
+        fixed_size_attachments_to_load.size() + attached_count_variable;
 
       parallel_forest = dealii::internal::p4est::functions<dim>::load_ext(
         file_basename.c_str(),
@@ -2188,12 +2238,20 @@ namespace parallel
         }
 
       // Load attached cell data, if any was stored.
-      this->load_attached_data(parallel_forest->global_first_quadrant[myrank],
-                               parallel_forest->global_num_quadrants,
-                               parallel_forest->local_num_quadrants,
-                               file_basename,
-                               attached_count_fixed,
-                               attached_count_variable);
+      if (indexed_layout)
+        this->load_attached_data(parallel_forest->global_first_quadrant[myrank],
+                                 parallel_forest->global_num_quadrants,
+                                 parallel_forest->local_num_quadrants,
+                                 file_basename,
+                                 fixed_size_attachments_to_load,
+                                 attached_count_variable);
+      else
+        this->load_attached_data(parallel_forest->global_first_quadrant[myrank],
+                                 parallel_forest->global_num_quadrants,
+                                 parallel_forest->local_num_quadrants,
+                                 file_basename,
+                                 attached_count_fixed,
+                                 attached_count_variable);
 
       // signal that de-serialization is finished
       this->signals.post_distributed_load();
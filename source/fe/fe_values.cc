@@ -25,8 +25,12 @@
 #include <deal.II/dofs/dof_accessor.h>
 
 #include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_poly.h>
+#include <deal.II/fe/fe_system.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping.h>
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
 
 #include <deal.II/grid/tria_accessor.h>
 #include <deal.II/grid/tria_iterator.h>
@@ -35,6 +39,8 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <memory>
 #include <type_traits>
@@ -168,6 +174,7 @@ FEValues<dim, spacedim>::FEValues(const Mapping<dim, spacedim>       &mapping,
                                 mapping,
                                 fe)
   , quadrature(q)
+  , similarity_cache_size(0)
 {
   initialize(update_flags);
 }
@@ -197,6 +204,7 @@ FEValues<dim, spacedim>::FEValues(const FiniteElement<dim, spacedim> &fe,
       fe.reference_cell().template get_default_linear_mapping<dim, spacedim>(),
       fe)
   , quadrature(q)
+  , similarity_cache_size(0)
 {
   initialize(update_flags);
 }
@@ -331,6 +339,23 @@ template <int dim, int spacedim>
 void
 FEValues<dim, spacedim>::do_reinit()
 {
+  // if the present cell is not a translation of the previous one, it may
+  // still be a translation of one of the cells stored in the similarity
+  // cache, in which case we only need to copy the data
+  const bool use_similarity_cache =
+    (similarity_cache_size > 0) && this->check_for_cell_similarity_allowed &&
+    (this->cell_similarity != CellSimilarity::translation) &&
+    (this->cell_similarity != CellSimilarity::inverted_translation);
+  if (use_similarity_cache &&
+      reinit_from_similarity_cache() != numbers::invalid_unsigned_int)
+    {
+      // the internal data of the mapping and the finite element still
+      // describe the cell visited before, so the next cell must not rely on
+      // them
+      this->cell_similarity = CellSimilarity::invalid_next_cell;
+      return;
+    }
+
   // first call the mapping and let it generate the data
   // specific to the mapping. also let it inspect the
   // cell similarity flag and, if necessary, update
@@ -357,6 +382,180 @@ FEValues<dim, spacedim>::do_reinit()
                                 this->mapping_output,
                                 *this->fe_data,
                                 this->finite_element_output);
+
+  if (use_similarity_cache &&
+      (this->cell_similarity != CellSimilarity::invalid_next_cell) &&
+      (similarity_cache.size() < similarity_cache_size))
+    add_to_similarity_cache();
+}
+
+
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::set_similarity_cache_size(
+  const unsigned int max_n_cells)
+{
+  similarity_cache.clear();
+  similarity_cache.shrink_to_fit();
+  similarity_cache_index.clear();
+  similarity_cache_size = 0;
+
+  if ((max_n_cells == 0) || !(this->update_flags & update_mapping))
+    return;
+
+  // the mapping of a cell must be determined by its vertices
+  const Mapping<dim, spacedim> &mapping = this->get_mapping();
+  if (const auto *mapping_q =
+        dynamic_cast<const MappingQ<dim, spacedim> *>(&mapping))
+    {
+      if ((mapping_q->get_degree() > 1) ||
+          (mapping_q->preserves_vertex_locations() == false))
+        return;
+    }
+  else if (dynamic_cast<const MappingCartesian<dim, spacedim> *>(&mapping) ==
+           nullptr)
+    return;
+
+  // the shape functions in real space must only depend on the mapping, which
+  // we know for elements derived from FE_Poly and systems of those
+  const std::function<bool(const FiniteElement<dim, spacedim> &)>
+    is_translation_invariant = [&](const FiniteElement<dim, spacedim> &fe) {
+      if (dynamic_cast<const FESystem<dim, spacedim> *>(&fe) != nullptr)
+        {
+          for (unsigned int b = 0; b < fe.n_base_elements(); ++b)
+            if (is_translation_invariant(fe.base_element(b)) == false)
+              return false;
+          return true;
+        }
+      else
+        return (dynamic_cast<const FE_Poly<dim, spacedim> *>(&fe) != nullptr);
+    };
+  if (is_translation_invariant(this->get_fe()) == false)
+    return;
+
+  similarity_cache_size = max_n_cells;
+}
+
+
+
+template <int dim, int spacedim>
+std::size_t
+FEValues<dim, spacedim>::compute_similarity_cache_key() const
+{
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell =
+    this->present_cell;
+  const Point<spacedim> first_vertex = cell->vertex(0);
+
+  double max_offset_square = 0.;
+  for (unsigned int v = 1; v < cell->n_vertices(); ++v)
+    {
+      const Tensor<1, spacedim> offset = cell->vertex(v) - first_vertex;
+      max_offset_square = std::max(max_offset_square, offset.norm_square());
+    }
+
+  // round the offsets to multiples of a power of two that is about 2^-24
+  // times the size of the cell. This is far coarser than the tolerance of
+  // the comparison in reinit_from_similarity_cache(), so translations of a
+  // cell only get different keys in the rare case that an offset is close
+  // to the boundary between two multiples, which merely results in another
+  // entry in the cache.
+  const double step =
+    max_offset_square > 0. ?
+      std::ldexp(1., std::ilogb(std::sqrt(max_offset_square)) - 24) :
+      1.;
+
+  const auto hash_combine = [](std::size_t &seed, const std::size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  };
+
+  std::size_t key = static_cast<std::uint8_t>(cell->reference_cell());
+  hash_combine(key, cell->direction_flag() ? 1 : 0);
+  for (unsigned int v = 1; v < cell->n_vertices(); ++v)
+    for (unsigned int d = 0; d < spacedim; ++d)
+      hash_combine(key,
+                   std::hash<long long>()(
+                     std::llround((cell->vertex(v)[d] - first_vertex[d]) /
+                                  step)));
+  return key;
+}
+
+
+
+template <int dim, int spacedim>
+unsigned int
+FEValues<dim, spacedim>::reinit_from_similarity_cache()
+{
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell =
+    this->present_cell;
+  const Point<spacedim> first_vertex = cell->vertex(0);
+
+  const auto candidates =
+    similarity_cache_index.equal_range(compute_similarity_cache_key());
+  for (auto candidate = candidates.first; candidate != candidates.second;
+       ++candidate)
+    {
+      const unsigned int          e     = candidate->second;
+      const SimilarityCacheEntry &entry = similarity_cache[e];
+      if ((entry.reference_cell != cell->reference_cell()) ||
+          (entry.direction_flag != cell->direction_flag()))
+        continue;
+
+      bool is_translation = true;
+      for (unsigned int v = 1; v < cell->n_vertices(); ++v)
+        if (((cell->vertex(v) - first_vertex) - entry.vertex_offsets[v - 1])
+              .norm_square() > entry.tolerance_square)
+          {
+            is_translation = false;
+            break;
+          }
+      if (is_translation == false)
+        continue;
+
+      this->mapping_output        = entry.mapping_output;
+      this->finite_element_output = entry.finite_element_output;
+
+      const Tensor<1, spacedim> shift = first_vertex - entry.first_vertex;
+      for (Point<spacedim> &point : this->mapping_output.quadrature_points)
+        point += shift;
+
+      return e;
+    }
+
+  return numbers::invalid_unsigned_int;
+}
+
+
+
+template <int dim, int spacedim>
+void
+FEValues<dim, spacedim>::add_to_similarity_cache()
+{
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell =
+    this->present_cell;
+
+  SimilarityCacheEntry entry;
+  entry.reference_cell = cell->reference_cell();
+  entry.direction_flag = cell->direction_flag();
+  entry.first_vertex   = cell->vertex(0);
+
+  // use the same relative tolerance as TriaAccessor::is_translation_of(),
+  // but relative to the size of the cell
+  double max_offset_square = 0.;
+  for (unsigned int v = 1; v < cell->n_vertices(); ++v)
+    {
+      entry.vertex_offsets.push_back(cell->vertex(v) - entry.first_vertex);
+      max_offset_square =
+        std::max(max_offset_square, entry.vertex_offsets.back().norm_square());
+    }
+  entry.tolerance_square = 1e-24 * max_offset_square;
+
+  entry.mapping_output        = this->mapping_output;
+  entry.finite_element_output = this->finite_element_output;
+
+  similarity_cache_index.emplace(compute_similarity_cache_key(),
+                                 similarity_cache.size());
+  similarity_cache.push_back(std::move(entry));
 }
 
 
@@ -365,8 +564,13 @@ template <int dim, int spacedim>
 std::size_t
 FEValues<dim, spacedim>::memory_consumption() const
 {
-  return (FEValuesBase<dim, spacedim>::memory_consumption() +
-          MemoryConsumption::memory_consumption(quadrature));
+  std::size_t memory = FEValuesBase<dim, spacedim>::memory_consumption() +
+                       MemoryConsumption::memory_consumption(quadrature);
+  for (const SimilarityCacheEntry &entry : similarity_cache)
+    memory += MemoryConsumption::memory_consumption(entry.vertex_offsets) +
+              entry.mapping_output.memory_consumption() +
+              entry.finite_element_output.memory_consumption();
+  return memory;
 }
 
 #endif
@@ -221,8 +221,8 @@ FEValuesBase<dim, spacedim>::FEValuesBase(
   , mapping(&mapping, typeid(*this).name())
   , fe(&fe, typeid(*this).name())
   , cell_similarity(CellSimilarity::Similarity::none)
-  , fe_values_views_cache(*this)
   , check_for_cell_similarity_allowed(MultithreadInfo::n_threads() == 1)
+  , fe_values_views_cache(*this)
 {
   Assert(n_q_points > 0,
          ExcMessage("There is nothing useful you can do with an FEValues "
@@ -0,0 +1,224 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/fe/fe_poly.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values_batch.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <int dim, typename Number>
+bool
+FEValuesBatch<dim, Number>::is_covariant_scalar_element(
+  const FiniteElement<dim> &fe)
+{
+  if (dynamic_cast<const FESystem<dim> *>(&fe) != nullptr)
+    {
+      for (unsigned int b = 0; b < fe.n_base_elements(); ++b)
+        if (is_covariant_scalar_element(fe.base_element(b)) == false)
+          return false;
+      return true;
+    }
+  else
+    return (dynamic_cast<const FE_Poly<dim> *>(&fe) != nullptr) &&
+           ((fe.requires_update_flags(update_values | update_gradients) &
+             update_rescale) == 0);
+}
+
+
+
+template <int dim, typename Number>
+FEValuesBatch<dim, Number>::FEValuesBatch(const Mapping<dim>       &mapping,
+                                          const FiniteElement<dim> &fe,
+                                          const Quadrature<dim>    &quadrature,
+                                          const UpdateFlags update_flags)
+  : dofs_per_cell(fe.n_dofs_per_cell())
+  , n_quadrature_points(quadrature.size())
+  , update_flags(update_flags)
+  , fe_values(mapping,
+              fe,
+              quadrature,
+              ((update_flags & update_gradients) ? update_inverse_jacobians :
+                                                   update_default) |
+                (update_flags & (update_quadrature_points | update_JxW_values)))
+  , n_cells(0)
+{
+  const UpdateFlags supported_flags = update_values | update_gradients |
+                                      update_quadrature_points |
+                                      update_JxW_values;
+  Assert((update_flags | supported_flags) == supported_flags,
+         ExcMessage("FEValuesBatch only supports the flags update_values, "
+                    "update_gradients, update_quadrature_points, and "
+                    "update_JxW_values."));
+  AssertThrow(is_covariant_scalar_element(fe),
+              ExcMessage("FEValuesBatch only supports elements derived from "
+                         "FE_Poly that do not rescale their shape functions "
+                         "and systems of such elements, but you passed an "
+                         "element of type " +
+                         fe.get_name() + "."));
+
+  // the values and the gradients on the reference cell are the same on all
+  // cells
+  if (update_flags & update_values)
+    {
+      values.reinit(dofs_per_cell, n_quadrature_points);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int q = 0; q < n_quadrature_points; ++q)
+          values(i, q) = fe.shape_value(i, quadrature.point(q));
+    }
+
+  if (update_flags & update_gradients)
+    {
+      unit_gradients.reinit(dofs_per_cell, n_quadrature_points);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        for (unsigned int q = 0; q < n_quadrature_points; ++q)
+          unit_gradients(i, q) = fe.shape_grad(i, quadrature.point(q));
+      gradients.reinit(dofs_per_cell, n_quadrature_points);
+      inverse_jacobians.resize(n_quadrature_points);
+    }
+
+  if (update_flags & update_quadrature_points)
+    quadrature_points.resize(n_quadrature_points);
+
+  if (update_flags & update_JxW_values)
+    JxW_values.resize(n_quadrature_points);
+}
+
+
+
+template <int dim, typename Number>
+void
+FEValuesBatch<dim, Number>::fill_lane(const unsigned int lane)
+{
+  AssertIndexRange(lane, n_lanes);
+
+  if (update_flags & update_gradients)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        const DerivativeForm<1, dim, dim> &inverse_jacobian =
+          fe_values.inverse_jacobian(q);
+        for (unsigned int d = 0; d < dim; ++d)
+          for (unsigned int e = 0; e < dim; ++e)
+            inverse_jacobians[q][d][e][lane] = inverse_jacobian[e][d];
+      }
+
+  if (update_flags & update_quadrature_points)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      for (unsigned int d = 0; d < dim; ++d)
+        quadrature_points[q][d][lane] = fe_values.quadrature_point(q)[d];
+
+  if (update_flags & update_JxW_values)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      JxW_values[q][lane] = fe_values.JxW(q);
+}
+
+
+
+template <int dim, typename Number>
+void
+FEValuesBatch<dim, Number>::finish_reinit(const unsigned int n_cells)
+{
+  this->n_cells = n_cells;
+
+  // repeat the last cell in the unused lanes, so that the data there are
+  // valid numbers
+  for (unsigned int lane = n_cells; lane < n_lanes; ++lane)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        if (update_flags & update_gradients)
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              inverse_jacobians[q][d][e][lane] =
+                inverse_jacobians[q][d][e][n_cells - 1];
+        if (update_flags & update_quadrature_points)
+          for (unsigned int d = 0; d < dim; ++d)
+            quadrature_points[q][d][lane] =
+              quadrature_points[q][d][n_cells - 1];
+        if (update_flags & update_JxW_values)
+          JxW_values[q][lane] = JxW_values[q][n_cells - 1];
+      }
+
+  // the covariant transformation of the gradients, done for all lanes at
+  // once
+  if (update_flags & update_gradients)
+    for (unsigned int q = 0; q < n_quadrature_points; ++q)
+      {
+        const Tensor<2, dim, VectorizedArrayType> &transformation =
+          inverse_jacobians[q];
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          {
+            const Tensor<1, dim, Number>        &unit_gradient =
+              unit_gradients(i, q);
+            Tensor<1, dim, VectorizedArrayType> &gradient = gradients(i, q);
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                gradient[d] = transformation[d][0] * unit_gradient[0];
+                for (unsigned int e = 1; e < dim; ++e)
+                  gradient[d] += transformation[d][e] * unit_gradient[e];
+              }
+          }
+      }
+}
+
+
+
+template <int dim, typename Number>
+const FiniteElement<dim> &
+FEValuesBatch<dim, Number>::get_fe() const
+{
+  return fe_values.get_fe();
+}
+
+
+
+template <int dim, typename Number>
+const Quadrature<dim> &
+FEValuesBatch<dim, Number>::get_quadrature() const
+{
+  return fe_values.get_quadrature();
+}
+
+
+
+template <int dim, typename Number>
+UpdateFlags
+FEValuesBatch<dim, Number>::get_update_flags() const
+{
+  return update_flags;
+}
+
+
+
+template <int dim, typename Number>
+std::size_t
+FEValuesBatch<dim, Number>::memory_consumption() const
+{
+  return fe_values.memory_consumption() +
+         MemoryConsumption::memory_consumption(unit_gradients) +
+         MemoryConsumption::memory_consumption(values) +
+         MemoryConsumption::memory_consumption(gradients) +
+         MemoryConsumption::memory_consumption(inverse_jacobians) +
+         MemoryConsumption::memory_consumption(quadrature_points) +
+         MemoryConsumption::memory_consumption(JxW_values);
+}
+
+
+
+// explicit instantiations
+#include "fe_values_batch.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -150,6 +150,36 @@ Mapping<dim, spacedim>::transform_points_real_to_unit_cell(
 
 
 
+template <int dim, int spacedim>
+void
+Mapping<dim, spacedim>::transform_points_real_to_unit_cells(
+  const ArrayView<const typename Triangulation<dim, spacedim>::cell_iterator>
+                                         &cells,
+  const ArrayView<const Point<spacedim>> &real_points,
+  const ArrayView<Point<dim>>            &unit_points) const
+{
+  AssertDimension(cells.size(), real_points.size());
+  AssertDimension(real_points.size(), unit_points.size());
+
+  // Pass each range of points with the same cell to the function working on
+  // a single cell
+  for (unsigned int begin = 0; begin < cells.size();)
+    {
+      unsigned int end = begin + 1;
+      while (end < cells.size() && cells[end] == cells[begin])
+        ++end;
+
+      transform_points_real_to_unit_cell(
+        cells[begin],
+        make_array_view(real_points.begin() + begin, real_points.begin() + end),
+        make_array_view(unit_points.begin() + begin,
+                        unit_points.begin() + end));
+      begin = end;
+    }
+}
+
+
+
 template <int dim, int spacedim>
 Point<dim - 1>
 Mapping<dim, spacedim>::project_real_point_to_unit_point_on_face(
@@ -1251,6 +1251,40 @@ MappingCartesian<dim, spacedim>::transform_points_real_to_unit_cell(
 
 
 
+template <int dim, int spacedim>
+void
+MappingCartesian<dim, spacedim>::transform_points_real_to_unit_cells(
+  const ArrayView<const typename Triangulation<dim, spacedim>::cell_iterator>
+                                         &cells,
+  const ArrayView<const Point<spacedim>> &real_points,
+  const ArrayView<Point<dim>>            &unit_points) const
+{
+  AssertDimension(cells.size(), real_points.size());
+  AssertDimension(real_points.size(), unit_points.size());
+
+  if (dim != spacedim)
+    DEAL_II_NOT_IMPLEMENTED();
+
+  // Only query the vertices when the cell changes between consecutive points
+  Point<dim>              start;
+  std::array<double, dim> inverse_lengths;
+  for (unsigned int i = 0; i < real_points.size(); ++i)
+    {
+      if (i == 0 || cells[i] != cells[i - 1])
+        {
+          Assert(is_cartesian(cells[i]), ExcCellNotCartesian());
+          start = cells[i]->vertex(0);
+          for (unsigned int d = 0; d < dim; ++d)
+            inverse_lengths[d] = 1. / (cells[i]->vertex(1 << d)[d] - start[d]);
+        }
+
+      for (unsigned int d = 0; d < dim; ++d)
+        unit_points[i][d] = (real_points[i][d] - start[d]) * inverse_lengths[d];
+    }
+}
+
+
+
 template <int dim, int spacedim>
 std::unique_ptr<Mapping<dim, spacedim>>
 MappingCartesian<dim, spacedim>::clone() const
@@ -713,6 +713,176 @@ MappingQ<dim, spacedim>::transform_points_real_to_unit_cell(
 
 
 
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::transform_points_real_to_unit_cells(
+  const ArrayView<const typename Triangulation<dim, spacedim>::cell_iterator>
+                                         &cells,
+  const ArrayView<const Point<spacedim>> &real_points,
+  const ArrayView<Point<dim>>            &unit_points) const
+{
+  // Go to base class functions for dim < spacedim because it is not yet
+  // implemented with optimized code.
+  if (dim < spacedim)
+    {
+      Mapping<dim, spacedim>::transform_points_real_to_unit_cells(cells,
+                                                                  real_points,
+                                                                  unit_points);
+      return;
+    }
+
+  AssertDimension(cells.size(), real_points.size());
+  AssertDimension(real_points.size(), unit_points.size());
+
+  using InverseApproximation = internal::MappingQImplementation::
+    InverseQuadraticApproximation<dim, spacedim>;
+
+  const unsigned int n_points = real_points.size();
+  const unsigned int n_lanes  = VectorizedArray<double>::size();
+  const unsigned int n_support_points =
+    Utilities::pow(polynomial_degree + 1, dim);
+
+  // The cells touched by the current batch of points, together with their
+  // support points and the approximation of the inverse map that provides
+  // the initial guess. The data of the last cell of a batch is kept for the
+  // next batch, such that points sorted by cells compute the data of each
+  // cell only once.
+  std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+                                            batch_cells;
+  std::vector<std::vector<Point<spacedim>>> batch_support_points;
+  std::vector<InverseApproximation>         batch_approximations;
+  std::vector<unsigned int>                 lane_to_cell(n_lanes);
+
+  std::vector<Point<spacedim, VectorizedArray<double>>> support_points_vec(
+    n_support_points);
+
+  for (unsigned int i = 0; i < n_points; i += n_lanes)
+    {
+      const unsigned int n_active_lanes = std::min(n_lanes, n_points - i);
+
+      if (batch_cells.size() > 1)
+        {
+          const auto last_cell = batch_cells.back();
+          std::vector<Point<spacedim>> last_support_points =
+            std::move(batch_support_points.back());
+          const InverseApproximation last_approximation =
+            batch_approximations.back();
+          batch_cells.clear();
+          batch_support_points.clear();
+          batch_approximations.clear();
+          batch_cells.push_back(last_cell);
+          batch_support_points.push_back(std::move(last_support_points));
+          batch_approximations.push_back(last_approximation);
+        }
+
+      for (unsigned int j = 0; j < n_active_lanes; ++j)
+        {
+          if (batch_cells.empty() || batch_cells.back() != cells[i + j])
+            {
+              batch_cells.push_back(cells[i + j]);
+              if (polynomial_degree == 1)
+                {
+                  const auto vertices = this->get_vertices(cells[i + j]);
+                  batch_support_points.emplace_back(vertices.begin(),
+                                                    vertices.end());
+                }
+              else
+                batch_support_points.push_back(
+                  this->compute_mapping_support_points(cells[i + j]));
+              batch_approximations.emplace_back(
+                make_array_view(batch_support_points.back()),
+                unit_cell_support_points);
+            }
+          lane_to_cell[j] = batch_cells.size() - 1;
+        }
+
+      // Points that are alone in their batch are computed with the scalar
+      // code path
+      if (n_active_lanes == 1)
+        {
+          const unsigned int c = lane_to_cell[0];
+          unit_points[i]       = internal::MappingQImplementation::
+            do_transform_real_to_unit_cell_internal<dim, spacedim>(
+              real_points[i],
+              batch_approximations[c].compute(real_points[i]),
+              ArrayView<const Point<spacedim>>(batch_support_points[c]),
+              polynomials_1d,
+              renumber_lexicographic_to_hierarchic);
+          continue;
+        }
+
+      // Fill the unused lanes with the data of the last active lane
+      Point<spacedim, VectorizedArray<double>> p_vec;
+      Point<dim, VectorizedArray<double>>      initial_vec;
+      for (unsigned int j = 0; j < n_lanes; ++j)
+        {
+          const unsigned int lane = std::min(j, n_active_lanes - 1);
+          const unsigned int c    = lane_to_cell[lane];
+          const Point<dim>   initial =
+            batch_approximations[c].compute(real_points[i + lane]);
+          for (unsigned int d = 0; d < spacedim; ++d)
+            p_vec[d][j] = real_points[i + lane][d];
+          for (unsigned int d = 0; d < dim; ++d)
+            initial_vec[d][j] = initial[d];
+        }
+
+      // If all points of the batch are in the same cell, the support points
+      // need not be vectorized
+      Point<dim, VectorizedArray<double>> unit_point;
+      if (lane_to_cell[0] == lane_to_cell[n_active_lanes - 1])
+        unit_point = internal::MappingQImplementation::
+          do_transform_real_to_unit_cell_internal<dim, spacedim>(
+            p_vec,
+            initial_vec,
+            ArrayView<const Point<spacedim>>(
+              batch_support_points[lane_to_cell[0]]),
+            polynomials_1d,
+            renumber_lexicographic_to_hierarchic);
+      else
+        {
+          for (unsigned int j = 0; j < n_lanes; ++j)
+            {
+              const std::vector<Point<spacedim>> &support_points =
+                batch_support_points[lane_to_cell[std::min(
+                  j, n_active_lanes - 1)]];
+              for (unsigned int k = 0; k < n_support_points; ++k)
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  support_points_vec[k][d][j] = support_points[k][d];
+            }
+          unit_point = internal::MappingQImplementation::
+            do_transform_real_to_unit_cell_internal<dim, spacedim>(
+              p_vec,
+              initial_vec,
+              ArrayView<const Point<spacedim, VectorizedArray<double>>>(
+                support_points_vec),
+              polynomials_1d,
+              renumber_lexicographic_to_hierarchic);
+        }
+
+      // As in transform_points_real_to_unit_cell(), lanes where the
+      // vectorized Newton iteration failed might succeed without the
+      // interference from other lanes, so repeat those with scalar
+      // arguments.
+      for (unsigned int j = 0; j < n_active_lanes; ++j)
+        if (numbers::is_finite(unit_point[0][j]))
+          for (unsigned int d = 0; d < dim; ++d)
+            unit_points[i + j][d] = unit_point[d][j];
+        else
+          {
+            const unsigned int c = lane_to_cell[j];
+            unit_points[i + j]   = internal::MappingQImplementation::
+              do_transform_real_to_unit_cell_internal<dim, spacedim>(
+                real_points[i + j],
+                batch_approximations[c].compute(real_points[i + j]),
+                ArrayView<const Point<spacedim>>(batch_support_points[c]),
+                polynomials_1d,
+                renumber_lexicographic_to_hierarchic);
+          }
+    }
+}
+
+
+
 template <int dim, int spacedim>
 UpdateFlags
 MappingQ<dim, spacedim>::requires_update_flags(const UpdateFlags in) const
@@ -47,6 +47,7 @@ MappingQCache<dim, spacedim>::MappingQCache(
   const MappingQCache<dim, spacedim> &mapping)
   : MappingQ<dim, spacedim>(mapping)
   , support_point_cache(mapping.support_point_cache)
+  , lazy_fill_data(mapping.lazy_fill_data)
   , uses_level_info(mapping.uses_level_info)
 {}
 
@@ -60,6 +61,7 @@ MappingQCache<dim, spacedim>::~MappingQCache()
   // invalid memory that has been left back by freeing an object of this
   // class.
   support_point_cache.reset();
+  lazy_fill_data.reset();
   clear_signal.disconnect();
 }
 
@@ -83,51 +85,87 @@ MappingQCache<dim, spacedim>::preserves_vertex_locations() const
 
 
 
+namespace internal
+{
+  /**
+   * A helper class that computes the mapping support points of a
+   * MappingQCache of degree @p degree by evaluating a copy of the given
+   * mapping with an FEValues object at the Gauss-Lobatto points. The
+   * FEValues objects are kept per thread, so that the points can be computed
+   * from several threads at once.
+   */
+  template <int dim, int spacedim>
+  class SupportPointsFromMapping
+  {
+  public:
+    SupportPointsFromMapping(const Mapping<dim, spacedim> &mapping,
+                             const unsigned int            degree)
+      : mapping(mapping.clone())
+      , degree(degree)
+    {}
+
+    const Mapping<dim, spacedim> &
+    get_mapping() const
+    {
+      return *mapping;
+    }
+
+    std::vector<Point<spacedim>>
+    compute(const typename Triangulation<dim, spacedim>::cell_iterator &cell)
+    {
+      // get FEValues (thread-safe); in the case that this thread has not
+      // created a an FEValues object yet, this helper-function also
+      // creates one with the right quadrature rule
+      auto &fe_values = fe_values_all.get();
+      if (fe_values.get() == nullptr)
+        {
+          const QGaussLobatto<dim> quadrature_gl(degree + 1);
+
+          std::vector<Point<dim>> quadrature_points;
+          for (const auto i :
+               FETools::hierarchic_to_lexicographic_numbering<dim>(degree))
+            quadrature_points.push_back(quadrature_gl.point(i));
+          const Quadrature<dim> quadrature(quadrature_points);
+
+          fe_values = std::make_unique<FEValues<dim, spacedim>>(
+            *mapping, fe, quadrature, update_quadrature_points);
+        }
+
+      fe_values->reinit(cell);
+      return fe_values->get_quadrature_points();
+    }
+
+  private:
+    const std::unique_ptr<Mapping<dim, spacedim>> mapping;
+    const unsigned int                            degree;
+
+    // FE and FEValues in the case they are needed
+    FE_Nothing<dim, spacedim> fe;
+    Threads::ThreadLocalStorage<std::unique_ptr<FEValues<dim, spacedim>>>
+      fe_values_all;
+  };
+} // namespace internal
+
+
+
 template <int dim, int spacedim>
 void
 MappingQCache<dim, spacedim>::initialize(
   const Mapping<dim, spacedim>       &mapping,
   const Triangulation<dim, spacedim> &triangulation)
 {
-  // FE and FEValues in the case they are needed
-  FE_Nothing<dim, spacedim> fe;
-  Threads::ThreadLocalStorage<std::unique_ptr<FEValues<dim, spacedim>>>
-    fe_values_all;
+  const auto mapping_q =
+    dynamic_cast<const MappingQ<dim, spacedim> *>(&mapping);
+  internal::SupportPointsFromMapping<dim, spacedim> support_points(
+    mapping, this->get_degree());
 
   this->initialize(
     triangulation,
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
-      const auto mapping_q =
-        dynamic_cast<const MappingQ<dim, spacedim> *>(&mapping);
       if (mapping_q != nullptr && this->get_degree() == mapping_q->get_degree())
-        {
-          return mapping_q->compute_mapping_support_points(cell);
-        }
+        return mapping_q->compute_mapping_support_points(cell);
       else
-        {
-          // get FEValues (thread-safe); in the case that this thread has not
-          // created a an FEValues object yet, this helper-function also
-          // creates one with the right quadrature rule
-          auto &fe_values = fe_values_all.get();
-          if (fe_values.get() == nullptr)
-            {
-              const QGaussLobatto<dim> quadrature_gl(this->polynomial_degree +
-                                                     1);
-
-              std::vector<Point<dim>> quadrature_points;
-              for (const auto i :
-                   FETools::hierarchic_to_lexicographic_numbering<dim>(
-                     this->polynomial_degree))
-                quadrature_points.push_back(quadrature_gl.point(i));
-              const Quadrature<dim> quadrature(quadrature_points);
-
-              fe_values = std::make_unique<FEValues<dim, spacedim>>(
-                mapping, fe, quadrature, update_quadrature_points);
-            }
-
-          fe_values->reinit(cell);
-          return fe_values->get_quadrature_points();
-        }
+        return support_points.compute(cell);
     });
 }
 
@@ -142,8 +180,11 @@ MappingQCache<dim, spacedim>::initialize(
     &compute_points_on_cell)
 {
   clear_signal.disconnect();
-  clear_signal = triangulation.signals.any_change.connect(
-    [&]() -> void { this->support_point_cache.reset(); });
+  clear_signal = triangulation.signals.any_change.connect([&]() -> void {
+    this->support_point_cache.reset();
+    this->lazy_fill_data.reset();
+  });
+  lazy_fill_data.reset();
 
   support_point_cache =
     std::make_shared<std::vector<std::vector<std::vector<Point<spacedim>>>>>(
@@ -174,6 +215,89 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::initialize_lazily(
+  const Mapping<dim, spacedim>       &mapping,
+  const Triangulation<dim, spacedim> &triangulation)
+{
+  // the function is called long after this function has returned, so it
+  // must own the mapping and the FEValues objects
+  const auto support_points =
+    std::make_shared<internal::SupportPointsFromMapping<dim, spacedim>>(
+      mapping, this->get_degree());
+
+  const auto mapping_q = dynamic_cast<const MappingQ<dim, spacedim> *>(
+    &support_points->get_mapping());
+  const bool use_mapping_q =
+    mapping_q != nullptr && this->get_degree() == mapping_q->get_degree();
+
+  this->initialize_lazily(
+    triangulation,
+    [support_points, mapping_q, use_mapping_q](
+      const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+      if (use_mapping_q)
+        return mapping_q->compute_mapping_support_points(cell);
+      else
+        return support_points->compute(cell);
+    });
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::initialize_lazily(
+  const Triangulation<dim, spacedim> &triangulation,
+  const std::function<std::vector<Point<spacedim>>(
+    const typename Triangulation<dim, spacedim>::cell_iterator &)>
+    &compute_points_on_cell)
+{
+  // upon a change of the triangulation, the points computed so far are
+  // discarded, but the cache stays usable: it is resized to the new
+  // triangulation and filled again on demand
+  clear_signal.disconnect();
+  clear_signal =
+    triangulation.signals.any_change.connect([this, &triangulation]() -> void {
+      this->reset_lazy_cache(triangulation);
+    });
+
+  support_point_cache =
+    std::make_shared<std::vector<std::vector<std::vector<Point<spacedim>>>>>();
+  lazy_fill_data = std::make_shared<LazyFillData>();
+  lazy_fill_data->compute_points_on_cell = compute_points_on_cell;
+  reset_lazy_cache(triangulation);
+
+  uses_level_info = true;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQCache<dim, spacedim>::reset_lazy_cache(
+  const Triangulation<dim, spacedim> &triangulation)
+{
+  Assert(support_point_cache.get() != nullptr &&
+           lazy_fill_data.get() != nullptr,
+         ExcInternalError());
+
+  // modify the shared objects in place, so that copies of this object
+  // created via clone() see the new state as well
+  support_point_cache->clear();
+  support_point_cache->resize(triangulation.n_levels());
+  lazy_fill_data->is_filled.clear();
+  lazy_fill_data->is_filled.resize(triangulation.n_levels());
+  for (unsigned int l = 0; l < triangulation.n_levels(); ++l)
+    {
+      (*support_point_cache)[l].resize(triangulation.n_raw_cells(l));
+      lazy_fill_data->is_filled[l] =
+        std::make_unique<std::atomic<bool>[]>(triangulation.n_raw_cells(l));
+    }
+}
+
+
+
 template <int dim, int spacedim>
 void
 MappingQCache<dim, spacedim>::initialize(
@@ -709,8 +833,8 @@ MappingQCache<dim, spacedim>::memory_consumption() const
 
 
 template <int dim, int spacedim>
-std::vector<Point<spacedim>>
-MappingQCache<dim, spacedim>::compute_mapping_support_points(
+const std::vector<Point<spacedim>> &
+MappingQCache<dim, spacedim>::get_cached_support_points(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
 {
   Assert(support_point_cache.get() != nullptr,
@@ -721,7 +845,43 @@ MappingQCache<dim, spacedim>::compute_mapping_support_points(
 
   AssertIndexRange(cell->level(), support_point_cache->size());
   AssertIndexRange(cell->index(), (*support_point_cache)[cell->level()].size());
-  return (*support_point_cache)[cell->level()][cell->index()];
+  std::vector<Point<spacedim>> &points =
+    (*support_point_cache)[cell->level()][cell->index()];
+
+  if (lazy_fill_data.get() != nullptr)
+    {
+      std::atomic<bool> &is_filled =
+        lazy_fill_data->is_filled[cell->level()][cell->index()];
+      if (is_filled.load(std::memory_order_acquire) == false)
+        {
+          // compute the points outside the lock, so that several threads can
+          // fill different cells at the same time, and only store them if no
+          // other thread has done so in the meantime
+          std::vector<Point<spacedim>> new_points =
+            lazy_fill_data->compute_points_on_cell(cell);
+          AssertDimension(new_points.size(),
+                          Utilities::pow(this->get_degree() + 1, dim));
+
+          std::lock_guard<std::mutex> lock(lazy_fill_data->mutex);
+          if (is_filled.load(std::memory_order_relaxed) == false)
+            {
+              points = std::move(new_points);
+              is_filled.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+  return points;
+}
+
+
+
+template <int dim, int spacedim>
+std::vector<Point<spacedim>>
+MappingQCache<dim, spacedim>::compute_mapping_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+{
+  return get_cached_support_points(cell);
 }
 
 
@@ -732,15 +892,7 @@ boost::container::small_vector<Point<spacedim>,
 MappingQCache<dim, spacedim>::get_vertices(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
 {
-  Assert(support_point_cache.get() != nullptr,
-         ExcMessage("Must call MappingQCache::initialize() before "
-                    "using it or after mesh has changed!"));
-
-  Assert(uses_level_info || cell->is_active(), ExcInternalError());
-
-  AssertIndexRange(cell->level(), support_point_cache->size());
-  AssertIndexRange(cell->index(), (*support_point_cache)[cell->level()].size());
-  const auto ptr = (*support_point_cache)[cell->level()][cell->index()].begin();
+  const auto ptr = get_cached_support_points(cell).begin();
   return boost::container::small_vector<Point<spacedim>,
                                         GeometryInfo<dim>::vertices_per_cell>(
     ptr, ptr + cell->n_vertices());
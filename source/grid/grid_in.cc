@@ -14,6 +14,7 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
 
@@ -37,7 +38,9 @@
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <locale>
 #include <map>
+#include <sstream>
 
 #ifdef DEAL_II_WITH_ASSIMP
 #  include <assimp/Importer.hpp>  // C++ importer interface
@@ -130,6 +133,83 @@ namespace
     if (is_only_hypercube)
       GridTools::consistently_order_cells(cells);
   }
+
+
+
+  /**
+   * Read @p n_records records from @p in, each of which consists of
+   * @p n_integers integer numbers followed by @p n_values floating point
+   * numbers and @p n_ignored further numbers that are skipped, and store the
+   * integers and values record by record in @p integers and @p values. Like
+   * with the stream extraction operators, the numbers are separated by any
+   * whitespace, so a record may span several lines or share a line with
+   * other records.
+   *
+   * The numbers are split off the stream sequentially, but their conversion
+   * from text, which is where most of the time goes when reading the
+   * vertices of large meshes, is done in parallel.
+   */
+  void
+  read_numbers(std::istream        &in,
+               const std::size_t    n_records,
+               const unsigned int   n_integers,
+               const unsigned int   n_values,
+               const unsigned int   n_ignored,
+               std::vector<long>   &integers,
+               std::vector<double> &values)
+  {
+    // collect the text of the numbers, separated by a single space, and the
+    // position in this text at which each record starts
+    const unsigned int       n_per_record = n_integers + n_values + n_ignored;
+    std::string              text;
+    std::vector<std::size_t> record_begin(n_records + 1);
+    std::string              number;
+    for (std::size_t r = 0; r < n_records; ++r)
+      {
+        record_begin[r] = text.size();
+        for (unsigned int i = 0; i < n_per_record; ++i)
+          {
+            in >> number;
+            AssertThrow(in.fail() == false, ExcIO());
+            text += number;
+            text += ' ';
+          }
+      }
+    record_begin[n_records] = text.size();
+
+    integers.resize(n_records * n_integers);
+    values.resize(n_records * n_values);
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      n_records,
+      [&](const std::size_t begin, const std::size_t end) {
+        // read with the "C" locale, independent of the locale of the process,
+        // like the stream extraction operators on the file do
+        std::istringstream record_stream(
+          text.substr(record_begin[begin],
+                      record_begin[end] - record_begin[begin]));
+        record_stream.imbue(std::locale::classic());
+        double ignored;
+        for (std::size_t r = begin; r < end; ++r)
+          {
+            for (unsigned int i = 0; i < n_integers; ++i)
+              record_stream >> integers[r * n_integers + i];
+            for (unsigned int i = 0; i < n_values; ++i)
+              record_stream >> values[r * n_values + i];
+            for (unsigned int i = 0; i < n_ignored; ++i)
+              record_stream >> ignored;
+            AssertThrow(record_stream.fail() == false,
+                        ExcMessage(
+                          "Could not read the numbers <" +
+                          text.substr(record_begin[r],
+                                      record_begin[r + 1] - record_begin[r]) +
+                          "> as " + std::to_string(n_integers) +
+                          " integer and " + std::to_string(n_values) +
+                          " floating point numbers."));
+          }
+      },
+      /* grainsize = */ 1024);
+  }
 } // namespace
 
 template <int dim, int spacedim>
@@ -937,23 +1017,23 @@ GridIn<dim, spacedim>::read_ucd(std::istream &in,
   // vertices vector
   std::map<int, int> vertex_indices;
 
-  for (unsigned int vertex = 0; vertex < n_vertices; ++vertex)
-    {
-      int    vertex_number;
-      double x[3];
-
-      // read vertex
-      AssertThrow(in.fail() == false, ExcIO());
-      in >> vertex_number >> x[0] >> x[1] >> x[2];
+  // read the vertex numbers and coordinates
+  {
+    std::vector<long>   vertex_numbers;
+    std::vector<double> coordinates;
+    read_numbers(in, n_vertices, 1, 3, 0, vertex_numbers, coordinates);
 
-      // store vertex
-      for (unsigned int d = 0; d < spacedim; ++d)
-        vertices[vertex][d] = x[d];
-      // store mapping; note that
-      // vertices_indices[i] is automatically
-      // created upon first usage
-      vertex_indices[vertex_number] = vertex;
-    }
+    for (unsigned int vertex = 0; vertex < n_vertices; ++vertex)
+      {
+        // store vertex
+        for (unsigned int d = 0; d < spacedim; ++d)
+          vertices[vertex][d] = coordinates[3 * vertex + d];
+        // store mapping; note that
+        // vertices_indices[i] is automatically
+        // created upon first usage
+        vertex_indices[vertex_numbers[vertex]] = vertex;
+      }
+  }
 
   // set up array of cells
   std::vector<CellData<dim>> cells;
@@ -2241,46 +2321,42 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
             in >> tagEntity >> dimEntity >> parametric >> numNodes;
           }
 
-        std::vector<int> vertex_numbers;
-        int              vertex_number;
+        // Read the vertex numbers and coordinates. The vertex number precedes
+        // the coordinates for the older formats, whereas format 4.1 lists
+        // all vertex numbers of the block first. Parametric coordinates
+        // follow the coordinates and are ignored.
+        std::vector<long>   vertex_numbers;
+        std::vector<double> coordinates;
         if (gmsh_file_format > 40)
-          for (unsigned long vertex_per_entity = 0;
-               vertex_per_entity < numNodes;
-               ++vertex_per_entity)
-            {
-              in >> vertex_number;
-              vertex_numbers.push_back(vertex_number);
-            }
+          {
+            std::vector<long>   no_integers;
+            std::vector<double> no_values;
+            read_numbers(in, numNodes, 1, 0, 0, vertex_numbers, no_values);
+            read_numbers(in,
+                         numNodes,
+                         0,
+                         3,
+                         parametric != 0 ? 2 : 0,
+                         no_integers,
+                         coordinates);
+          }
+        else
+          read_numbers(in,
+                       numNodes,
+                       1,
+                       3,
+                       parametric != 0 ? 2 : 0,
+                       vertex_numbers,
+                       coordinates);
 
         for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes;
              ++vertex_per_entity, ++global_vertex)
           {
-            int    vertex_number;
-            double x[3];
-
-            // read vertex
-            if (gmsh_file_format > 40)
-              {
-                vertex_number = vertex_numbers[vertex_per_entity];
-                in >> x[0] >> x[1] >> x[2];
-              }
-            else
-              in >> vertex_number >> x[0] >> x[1] >> x[2];
-
             for (unsigned int d = 0; d < spacedim; ++d)
-              vertices[global_vertex][d] = x[d];
+              vertices[global_vertex][d] =
+                coordinates[3 * vertex_per_entity + d];
             // store mapping
-            vertex_indices[vertex_number] = global_vertex;
-
-            // ignore parametric coordinates
-            if (parametric != 0)
-              {
-                double u = 0.;
-                double v = 0.;
-                in >> u >> v;
-                (void)u;
-                (void)v;
-              }
+            vertex_indices[vertex_numbers[vertex_per_entity]] = global_vertex;
           }
       }
     AssertDimension(global_vertex, n_vertices);
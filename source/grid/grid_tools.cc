@@ -16,6 +16,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_consensus_algorithms.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/thread_management.h>
 
@@ -90,6 +91,7 @@ namespace ArborXWrappers
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <iostream>
@@ -824,7 +826,11 @@ namespace GridTools
       const RTree<
         std::pair<BoundingBox<spacedim>,
                   typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        *relevant_cell_bounding_boxes_rtree)
+        *relevant_cell_bounding_boxes_rtree,
+      const std::function<const BoundingVolumeHierarchy<
+        spacedim,
+        typename Triangulation<dim, spacedim>::active_cell_iterator> &()>
+        &get_cell_bounding_boxes_bvh)
   {
     std::pair<typename MeshType<dim, spacedim>::active_cell_iterator,
               Point<dim>>
@@ -1047,10 +1053,48 @@ namespace GridTools
         // while loop we performed an actual global search on the mesh
         // vertices. Not finding the point then means the point is outside the
         // domain, or that we've had problems with the algorithm above. Try as a
-        // last resort the other (simpler) algorithm.
+        // last resort the other (simpler) algorithm, or, if available, check
+        // all the cells whose bounding box contains the point with the same
+        // criterion as that algorithm.
         if (current_cell.state() != IteratorState::valid)
-          return find_active_cell_around_point(
-            mapping, mesh, p, marked_vertices, tolerance);
+          {
+            if (!get_cell_bounding_boxes_bvh)
+              return find_active_cell_around_point(
+                mapping, mesh, p, marked_vertices, tolerance);
+
+            double best_distance = tolerance;
+            int    best_level    = -1;
+            for (const auto &tria_cell : get_cell_bounding_boxes_bvh().query(p))
+              {
+                const typename MeshType<dim, spacedim>::active_cell_iterator
+                  cell(&mesh.get_triangulation(),
+                       tria_cell->level(),
+                       tria_cell->index(),
+                       &mesh);
+                if (cell->is_artificial() || !cell_marked(cell))
+                  continue;
+
+                try
+                  {
+                    const Point<dim> p_unit =
+                      mapping.transform_real_to_unit_cell(cell, p);
+                    const double dist = p_unit.distance(
+                      cell->reference_cell().closest_point(p_unit));
+                    if ((dist < best_distance) ||
+                        ((dist == best_distance) &&
+                         (cell->level() > best_level)))
+                      {
+                        best_distance            = dist;
+                        best_level               = cell->level();
+                        cell_and_position.first  = cell;
+                        cell_and_position.second = p_unit;
+                      }
+                  }
+                catch (typename Mapping<dim>::ExcTransformationFailed &)
+                  {}
+              }
+            return cell_and_position;
+          }
 
         current_cell = typename MeshType<dim, spacedim>::active_cell_iterator();
       }
@@ -2088,6 +2132,141 @@ namespace GridTools
   }
 
 
+  namespace internal
+  {
+    template <int spacedim>
+    void
+    compute_hilbert_keys(const ArrayView<const Point<spacedim>> &points,
+                         const BoundingBox<spacedim>            &bounding_box,
+                         const ArrayView<std::uint64_t>         &keys)
+    {
+      AssertDimension(points.size(), keys.size());
+
+      const int           bits_per_dim = hilbert_key_bits_per_dim<spacedim>;
+      const std::uint64_t max_int = (std::uint64_t(1) << bits_per_dim) - 1;
+
+      const auto &[lower_left, upper_right] =
+        bounding_box.get_boundary_points();
+
+      std::vector<std::array<std::uint64_t, spacedim>> int_points(
+        points.size());
+      for (unsigned int i = 0; i < points.size(); ++i)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          {
+            const double extent = upper_right[d] - lower_left[d];
+            if (extent > 0.)
+              int_points[i][d] = std::min<std::uint64_t>(
+                (points[i][d] - lower_left[d]) / extent * max_int, max_int);
+            else
+              int_points[i][d] = 0;
+          }
+
+      const auto hilbert_indices =
+        Utilities::inverse_Hilbert_space_filling_curve<spacedim>(int_points,
+                                                                 bits_per_dim);
+
+      for (unsigned int i = 0; i < points.size(); ++i)
+        keys[i] =
+          Utilities::pack_integers<spacedim>(hilbert_indices[i], bits_per_dim);
+    }
+  } // namespace internal
+
+
+
+  template <int dim, int spacedim>
+  void
+  partition_triangulation_hilbert(
+    const unsigned int               n_partitions,
+    Triangulation<dim, spacedim>    &triangulation,
+    const std::vector<unsigned int> &cell_weights)
+  {
+    Assert((dynamic_cast<parallel::distributed::Triangulation<dim, spacedim> *>(
+              &triangulation) == nullptr),
+           ExcMessage("Objects of type parallel::distributed::Triangulation "
+                      "are already partitioned implicitly and can not be "
+                      "partitioned again explicitly."));
+    Assert(n_partitions > 0, ExcInvalidNumberOfPartitions(n_partitions));
+    Assert(cell_weights.empty() ||
+             cell_weights.size() == triangulation.n_active_cells(),
+           ExcDimensionMismatch(cell_weights.size(),
+                                triangulation.n_active_cells()));
+
+    // signal that partitioning is going to happen
+    triangulation.signals.pre_partition();
+
+    // check for an easy return
+    if (n_partitions == 1 || triangulation.n_active_cells() == 0)
+      {
+        for (const auto &cell : triangulation.active_cell_iterators())
+          cell->set_subdomain_id(0);
+        return;
+      }
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells;
+    cells.reserve(triangulation.n_active_cells());
+    for (const auto &cell : triangulation.active_cell_iterators())
+      cells.push_back(cell);
+
+    // compute the cell centers in parallel, and their bounding box
+    std::vector<Point<spacedim>> centers(cells.size());
+    parallel::apply_to_subranges(
+      0u,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
+          centers[i] = cells[i]->center();
+      },
+      1024);
+
+    const BoundingBox<spacedim> bounding_box(centers);
+
+    // compute the index of each center on a Hilbert curve through the
+    // bounding box. Each point is treated independently, so the result
+    // does not depend on how the work is split among the threads.
+    std::vector<std::uint64_t> hilbert_keys(cells.size());
+    parallel::apply_to_subranges(
+      0u,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        internal::compute_hilbert_keys<spacedim>(
+          make_array_view(centers, begin, end - begin),
+          bounding_box,
+          make_array_view(hilbert_keys, begin, end - begin));
+      },
+      1024);
+
+    std::vector<std::pair<std::uint64_t, unsigned int>> keys(cells.size());
+    for (unsigned int i = 0; i < cells.size(); ++i)
+      keys[i] = {hilbert_keys[i], i};
+
+    // sort the cells along the curve, ties being broken by the position in
+    // the list of active cells, and cut the curve into pieces of equal
+    // weight
+    std::sort(keys.begin(), keys.end());
+
+    std::uint64_t total_weight = cells.size();
+    if (cell_weights.empty() == false)
+      total_weight = std::accumulate(cell_weights.begin(),
+                                     cell_weights.end(),
+                                     std::uint64_t(0));
+
+    std::uint64_t weight = 0;
+    for (const auto &key : keys)
+      {
+        const auto &cell = cells[key.second];
+        cell->set_subdomain_id(
+          total_weight > 0 ?
+            std::min<std::uint64_t>(weight * n_partitions / total_weight,
+                                    n_partitions - 1) :
+            0);
+        weight +=
+          cell_weights.empty() ? 1 : cell_weights[cell->active_cell_index()];
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   partition_multigrid_levels(Triangulation<dim, spacedim> &triangulation)
@@ -4592,15 +4771,20 @@ namespace GridTools
       cache.get_vertex_to_cell_centers_directions();
     const auto &used_vertices_rtree = cache.get_used_vertices_rtree();
 
-    return find_active_cell_around_point(mapping,
-                                         mesh,
-                                         p,
-                                         vertex_to_cells,
-                                         vertex_to_cell_centers,
-                                         cell_hint,
-                                         marked_vertices,
-                                         used_vertices_rtree,
-                                         tolerance);
+    return find_active_cell_around_point<dim, Triangulation, spacedim>(
+      mapping,
+      mesh,
+      p,
+      vertex_to_cells,
+      vertex_to_cell_centers,
+      cell_hint,
+      marked_vertices,
+      used_vertices_rtree,
+      tolerance,
+      nullptr,
+      [&cache]() -> const auto & {
+        return cache.get_cell_bounding_boxes_bvh();
+      });
   }
 
   template <int spacedim>
@@ -23,6 +23,58 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  namespace
+  {
+    /**
+     * Return the indices of all vertices whose entry in the map returned by
+     * GridTools::vertex_to_cell_map() contains the given active cell: the
+     * vertices of the cell itself, the hanging vertices on its faces, and in
+     * 3d the hanging vertices in the middle of its edges. Some indices may
+     * appear more than once.
+     */
+    template <int dim, int spacedim>
+    std::vector<unsigned int>
+    adjacent_vertex_indices(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell)
+    {
+      std::vector<unsigned int> vertices;
+      for (const unsigned int v : cell->vertex_indices())
+        vertices.push_back(cell->vertex_index(v));
+
+      if constexpr (dim > 1)
+        {
+          std::vector<typename Triangulation<dim, spacedim>::face_iterator>
+            faces;
+          for (const unsigned int f : cell->face_indices())
+            if (cell->face(f)->has_children())
+              faces.push_back(cell->face(f));
+
+          while (!faces.empty())
+            {
+              const auto face = faces.back();
+              faces.pop_back();
+              for (unsigned int c = 0; c < face->n_children(); ++c)
+                {
+                  const auto child = face->child(c);
+                  for (unsigned int v = 0; v < child->n_vertices(); ++v)
+                    vertices.push_back(child->vertex_index(v));
+                  if (child->has_children())
+                    faces.push_back(child);
+                }
+            }
+        }
+
+      if (dim == 3)
+        for (unsigned int l = 0; l < cell->n_lines(); ++l)
+          if (cell->line(l)->has_children())
+            vertices.push_back(cell->line(l)->child(0)->vertex_index(1));
+
+      return vertices;
+    }
+  } // namespace
+
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim>       &mapping)
@@ -30,8 +82,10 @@ namespace GridTools
     , tria(&tria)
     , mapping(&mapping)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    tria_change_signal = tria.signals.any_change.connect(
+      [&]() { update_after_triangulation_change(); });
+    tria_pre_refinement_signal = tria.signals.pre_refinement.connect(
+      [&]() { prepare_incremental_update(); });
   }
 
 
@@ -41,8 +95,10 @@ namespace GridTools
     : update_flags(update_all)
     , tria(&tria)
   {
-    tria_change_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    tria_change_signal = tria.signals.any_change.connect(
+      [&]() { update_after_triangulation_change(); });
+    tria_pre_refinement_signal = tria.signals.pre_refinement.connect(
+      [&]() { prepare_incremental_update(); });
 
     // Allow users to set this class up with an empty Triangulation and no
     // Mapping argument by deferring Mapping assignment until after the
@@ -69,6 +125,8 @@ namespace GridTools
   {
     if (tria_change_signal.connected())
       tria_change_signal.disconnect();
+    if (tria_pre_refinement_signal.connected())
+      tria_pre_refinement_signal.disconnect();
     if (tria_create_signal.connected())
       tria_create_signal.disconnect();
   }
@@ -84,6 +142,264 @@ namespace GridTools
 
 
 
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::prepare_incremental_update()
+  {
+    incremental_update = IncrementalUpdate();
+
+    // Only the local part of a parallel triangulation is refined here, and
+    // the ghost layer changes in ways we cannot follow, so rebuild everything
+    // in that case. The same applies to anisotropic refinement, for which
+    // the hanging vertices are not tracked.
+    if (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+          &*tria) != nullptr ||
+        !tria->all_reference_cells_are_hyper_cube())
+      return;
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      removed_cells;
+    for (const auto &cell : tria->active_cell_iterators())
+      if (cell->refine_flag_set())
+        {
+          if (cell->refine_flag_set() !=
+              RefinementCase<dim>::isotropic_refinement)
+            {
+              incremental_update = IncrementalUpdate();
+              return;
+            }
+          incremental_update.refined_cells.push_back(cell);
+          removed_cells.push_back(cell);
+        }
+
+    // Use the same criterion as Triangulation::execute_coarsening() to
+    // find the cells whose children are going to be removed
+    for (const auto &cell : tria->cell_iterators())
+      if (!cell->is_active() && cell->child(0)->coarsen_flag_set())
+        {
+          incremental_update.coarsened_cells.push_back(cell);
+          for (unsigned int c = 0; c < cell->n_children(); ++c)
+            {
+              removed_cells.push_back(cell->child(c));
+              for (const unsigned int v : cell->child(c)->vertex_indices())
+                incremental_update.coarsened_vertices.push_back(
+                  cell->child(c)->vertex_index(v));
+            }
+        }
+
+    const auto flags = static_cast<CacheUpdateFlags>(update_flags.load());
+
+    if (!(flags & update_vertex_to_cell_map))
+      {
+        std::lock_guard<std::mutex> lock(vertex_to_cells_mutex);
+
+        incremental_update.flags |= update_vertex_to_cell_map;
+        if (!(flags & (update_vertex_to_cell_centers_directions &
+                       ~update_vertex_to_cell_map)))
+          incremental_update.flags |= update_vertex_to_cell_centers_directions;
+
+        // Every cell whose entries can change shares a vertex with one of
+        // the removed cells, so it is found in the current map. Remove the
+        // entries of all of these cells; those of the cells that persist are
+        // added again after the refinement.
+        std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>
+          touched_cells;
+        for (const auto &cell : removed_cells)
+          for (const unsigned int v :
+               adjacent_vertex_indices<dim, spacedim>(cell))
+            touched_cells.insert(vertex_to_cells[v].begin(),
+                                 vertex_to_cells[v].end());
+
+        for (const auto &cell : touched_cells)
+          {
+            for (const unsigned int v :
+                 adjacent_vertex_indices<dim, spacedim>(cell))
+              {
+                vertex_to_cells[v].erase(cell);
+                incremental_update.touched_vertices.push_back(v);
+              }
+
+            const bool is_removed =
+              cell->refine_flag_set() ||
+              (cell->level() > 0 &&
+               cell->parent()->child(0)->coarsen_flag_set());
+            if (!is_removed)
+              incremental_update.touched_cells.push_back(cell);
+          }
+      }
+
+    if (!(flags & (update_used_vertices | update_used_vertices_rtree)))
+      incremental_update.flags |=
+        update_used_vertices | update_used_vertices_rtree;
+    else if (!(flags & update_used_vertices))
+      incremental_update.flags |= update_used_vertices;
+
+    if (!(flags & update_cell_bounding_boxes_rtree))
+      {
+        std::lock_guard<std::mutex> lock(cell_bounding_boxes_rtree_mutex);
+
+        incremental_update.flags |= update_cell_bounding_boxes_rtree;
+        for (const auto &cell : removed_cells)
+          cell_bounding_boxes_rtree.remove(
+            std::make_pair(mapping->get_bounding_box(cell), cell));
+      }
+
+    // In a serial triangulation, all cells are locally owned
+    if (!(flags & update_locally_owned_cell_bounding_boxes_rtree))
+      {
+        std::lock_guard<std::mutex> lock(
+          locally_owned_cell_bounding_boxes_rtree_mutex);
+
+        incremental_update.flags |=
+          update_locally_owned_cell_bounding_boxes_rtree;
+        for (const auto &cell : removed_cells)
+          locally_owned_cell_bounding_boxes_rtree.remove(
+            std::make_pair(mapping->get_bounding_box(cell), cell));
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  Cache<dim, spacedim>::update_after_triangulation_change()
+  {
+    const CacheUpdateFlags flags = incremental_update.flags;
+    if (flags == update_nothing)
+      {
+        mark_for_update(update_all);
+        return;
+      }
+
+    // Collect the cells that have been created by the refinement
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      new_cells;
+    for (const auto &cell : incremental_update.refined_cells)
+      for (unsigned int c = 0; c < cell->n_children(); ++c)
+        new_cells.emplace_back(cell->child(c));
+    for (const auto &cell : incremental_update.coarsened_cells)
+      new_cells.emplace_back(cell);
+
+    if (flags & update_vertex_to_cell_map)
+      {
+        std::lock_guard<std::mutex> lock(vertex_to_cells_mutex);
+
+        std::vector<unsigned int> &touched_vertices =
+          incremental_update.touched_vertices;
+
+        vertex_to_cells.resize(tria->n_vertices());
+        for (const auto *cells :
+             {&new_cells, &incremental_update.touched_cells})
+          for (const auto &cell : *cells)
+            for (const unsigned int v :
+                 adjacent_vertex_indices<dim, spacedim>(cell))
+              {
+                vertex_to_cells[v].insert(cell);
+                touched_vertices.push_back(v);
+              }
+
+        if (flags & (update_vertex_to_cell_centers_directions &
+                     ~update_vertex_to_cell_map))
+          {
+            std::lock_guard<std::mutex> lock(vertex_to_cell_centers_mutex);
+
+            std::sort(touched_vertices.begin(), touched_vertices.end());
+            touched_vertices.erase(std::unique(touched_vertices.begin(),
+                                               touched_vertices.end()),
+                                   touched_vertices.end());
+
+            // Recompute the directions of the touched vertices in the same
+            // way as GridTools::vertex_to_cell_centers_directions()
+            const std::vector<Point<spacedim>> &vertices = tria->get_vertices();
+            vertex_to_cell_centers.resize(tria->n_vertices());
+            for (const unsigned int vertex : touched_vertices)
+              {
+                std::vector<Tensor<1, spacedim>> &directions =
+                  vertex_to_cell_centers[vertex];
+                directions.clear();
+                if (tria->vertex_used(vertex))
+                  for (const auto &cell : vertex_to_cells[vertex])
+                    {
+                      directions.push_back(cell->center() - vertices[vertex]);
+                      directions.back() /= directions.back().norm();
+                    }
+              }
+          }
+      }
+
+    if (flags & update_used_vertices)
+      {
+        std::lock_guard<std::mutex> lock(used_vertices_mutex);
+        std::lock_guard<std::mutex> rtree_lock(used_vertices_rtree_mutex);
+
+        const bool update_rtree = (flags & update_used_vertices_rtree);
+
+        for (const unsigned int v : incremental_update.coarsened_vertices)
+          if (!tria->vertex_used(v))
+            {
+              const auto it = used_vertices.find(v);
+              if (it != used_vertices.end())
+                {
+                  if (update_rtree)
+                    used_vertices_rtree.remove(std::make_pair(it->second, v));
+                  used_vertices.erase(it);
+                }
+            }
+
+        // The index of a vertex removed by coarsening may be reused for a
+        // new vertex at a different position
+        for (const auto &cell : new_cells)
+          {
+            const auto vs = mapping->get_vertices(cell);
+            for (unsigned int i = 0; i < vs.size(); ++i)
+              {
+                const unsigned int v  = cell->vertex_index(i);
+                const auto         it = used_vertices.find(v);
+                if (it == used_vertices.end())
+                  {
+                    used_vertices.emplace(v, vs[i]);
+                    if (update_rtree)
+                      used_vertices_rtree.insert(std::make_pair(vs[i], v));
+                  }
+                else if (it->second != vs[i])
+                  {
+                    if (update_rtree)
+                      {
+                        used_vertices_rtree.remove(
+                          std::make_pair(it->second, v));
+                        used_vertices_rtree.insert(std::make_pair(vs[i], v));
+                      }
+                    it->second = vs[i];
+                  }
+              }
+          }
+      }
+
+    if (flags & update_cell_bounding_boxes_rtree)
+      {
+        std::lock_guard<std::mutex> lock(cell_bounding_boxes_rtree_mutex);
+        for (const auto &cell : new_cells)
+          cell_bounding_boxes_rtree.insert(
+            std::make_pair(mapping->get_bounding_box(cell), cell));
+      }
+
+    if (flags & update_locally_owned_cell_bounding_boxes_rtree)
+      {
+        std::lock_guard<std::mutex> lock(
+          locally_owned_cell_bounding_boxes_rtree_mutex);
+        for (const auto &cell : new_cells)
+          locally_owned_cell_bounding_boxes_rtree.insert(
+            std::make_pair(mapping->get_bounding_box(cell), cell));
+      }
+
+    incremental_update = IncrementalUpdate();
+
+    // Mark everything else for update
+    mark_for_update(static_cast<CacheUpdateFlags>(update_all & ~flags));
+  }
+
+
+
   template <int dim, int spacedim>
   const std::vector<
     std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>> &
@@ -222,6 +538,37 @@ namespace GridTools
 
 
 
+  template <int dim, int spacedim>
+  const BoundingVolumeHierarchy<
+    spacedim,
+    typename Triangulation<dim, spacedim>::active_cell_iterator> &
+  Cache<dim, spacedim>::get_cell_bounding_boxes_bvh() const
+  {
+    std::lock_guard<std::mutex> lock(cell_bounding_boxes_bvh_mutex);
+
+    if (update_flags & update_cell_bounding_boxes_bvh)
+      {
+        std::vector<std::pair<
+          BoundingBox<spacedim>,
+          typename Triangulation<dim, spacedim>::active_cell_iterator>>
+          boxes;
+        boxes.reserve(tria->n_active_cells());
+        for (const auto &cell : tria->active_cell_iterators())
+          boxes.emplace_back(
+            mapping->get_bounding_box(cell).create_extended_relative(0.1),
+            cell);
+
+        cell_bounding_boxes_bvh.reinit(boxes);
+
+        // Atomically clear the flag that indicates that this data member
+        // needs to be updated:
+        update_flags &= ~update_cell_bounding_boxes_bvh;
+      }
+    return cell_bounding_boxes_bvh;
+  }
+
+
+
   template <int dim, int spacedim>
   const RTree<
     std::pair<BoundingBox<spacedim>,
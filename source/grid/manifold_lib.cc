@@ -32,6 +32,7 @@
 #include <cmath>
 #include <limits>
 #include <memory>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -1716,18 +1717,115 @@ namespace
            cell.vertex(1) * chart_point[0];
   }
 
+  // this is replicated from GeometryInfo::face_to_cell_vertices since we need
+  // it very often in compute_transfinite_interpolation and the function is
+  // performance critical
+  static constexpr unsigned int face_to_cell_vertices_3d[6][4] = {{0, 2, 4, 6},
+                                                                  {1, 3, 5, 7},
+                                                                  {0, 4, 1, 5},
+                                                                  {2, 6, 3, 7},
+                                                                  {0, 1, 2, 3},
+                                                                  {4, 5, 6, 7}};
+
+  // this is replicated from GeometryInfo::face_to_cell_lines since we need it
+  // very often in compute_transfinite_interpolation and the function is
+  // performance critical
+  static constexpr unsigned int face_to_cell_lines_3d[6][4] = {{8, 10, 0, 4},
+                                                               {9, 11, 1, 5},
+                                                               {2, 6, 8, 9},
+                                                               {3, 7, 10, 11},
+                                                               {0, 1, 2, 3},
+                                                               {4, 5, 6, 7}};
+
+  // Compute the points on a curved line or face of a cell for the transfinite
+  // interpolation. The line or face is described by @p manifold and its
+  // @p vertices, and @p compute_weights(i) returns the weights of the
+  // vertices for the i-th of the @p n_new_points points. The table
+  // @p weights is only used as scratch memory and keeps its memory between
+  // calls. A single point, which is the common case of push_forward(), is
+  // computed by Manifold::get_new_point() without setting up a table.
+  template <int dim,
+            int spacedim,
+            std::size_t n_vertices,
+            typename WeightFunction>
+  void
+  compute_points_on_object(
+    const Manifold<dim, spacedim>                        &manifold,
+    const std::array<Point<spacedim>, n_vertices>        &vertices,
+    const unsigned int                                    n_new_points,
+    const WeightFunction                                 &compute_weights,
+    Table<2, double>                                     &weights,
+    boost::container::small_vector<Point<spacedim>, 100> &new_points)
+  {
+    new_points.resize(n_new_points);
+    if (n_new_points == 1)
+      {
+        const std::array<double, n_vertices> point_weights =
+          compute_weights(0);
+        new_points[0] =
+          manifold.get_new_point(make_array_view(vertices.begin(),
+                                                 vertices.end()),
+                                 make_array_view(point_weights.begin(),
+                                                 point_weights.end()));
+      }
+    else
+      {
+        weights.reinit(n_new_points, n_vertices, true);
+        for (unsigned int i = 0; i < n_new_points; ++i)
+          {
+            const std::array<double, n_vertices> point_weights =
+              compute_weights(i);
+            for (unsigned int v = 0; v < n_vertices; ++v)
+              weights(i, v) = point_weights[v];
+          }
+        manifold.get_new_points(make_array_view(vertices.begin(),
+                                                vertices.end()),
+                                weights,
+                                make_array_view(new_points.begin(),
+                                                new_points.end()));
+      }
+  }
+
+  // The following functions evaluate the transfinite interpolation for all
+  // points in @p chart_points at once. The cell's vertices and the manifold
+  // ids of its lines and faces are looked up only once, and the points on
+  // curved lines and faces are computed with a single call to
+  // Manifold::get_new_points() per line or face, which allows the manifolds
+  // to use their batched implementations. The evaluation in a single point
+  // further down calls these functions with one point.
+
+  // version for 1d
+  template <typename AccessorType>
+  void
+  compute_transfinite_interpolation(
+    const AccessorType                                    &cell,
+    const ArrayView<const Point<1>>                       &chart_points,
+    const bool                                             cell_is_flat,
+    const ArrayView<Point<AccessorType::space_dimension>> &new_points)
+  {
+    AssertDimension(chart_points.size(), new_points.size());
+    for (unsigned int p = 0; p < chart_points.size(); ++p)
+      new_points[p] =
+        compute_transfinite_interpolation(cell, chart_points[p], cell_is_flat);
+  }
+
   // version for 2d
   template <typename AccessorType>
-  Point<AccessorType::space_dimension>
-  compute_transfinite_interpolation(const AccessorType &cell,
-                                    const Point<2>     &chart_point,
-                                    const bool          cell_is_flat)
+  void
+  compute_transfinite_interpolation(
+    const AccessorType                                    &cell,
+    const ArrayView<const Point<2>>                       &chart_points,
+    const bool                                             cell_is_flat,
+    const ArrayView<Point<AccessorType::space_dimension>> &new_points)
   {
     const unsigned int       dim             = AccessorType::dimension;
     const unsigned int       spacedim        = AccessorType::space_dimension;
     const types::manifold_id my_manifold_id  = cell.manifold_id();
     const Triangulation<dim, spacedim> &tria = cell.get_triangulation();
 
+    const unsigned int n_points = chart_points.size();
+    AssertDimension(n_points, new_points.size());
+
     // formula see wikipedia
     // https://en.wikipedia.org/wiki/Transfinite_interpolation
     // S(u,v) = (1-v)c_1(u)+v c_3(u) + (1-u)c_2(v) + u c_4(v) -
@@ -1738,17 +1836,19 @@ namespace
     // this evaluates all bilinear shape functions because we need them
     // repeatedly. we will update this values in the complicated case with
     // curved lines below
-    std::array<double, 4> weights_vertices{
-      {(1. - chart_point[0]) * (1. - chart_point[1]),
-       chart_point[0] * (1. - chart_point[1]),
-       (1. - chart_point[0]) * chart_point[1],
-       chart_point[0] * chart_point[1]}};
-
-    Point<spacedim> new_point;
-    if (cell_is_flat)
-      for (const unsigned int v : GeometryInfo<2>::vertex_indices())
-        new_point += weights_vertices[v] * vertices[v];
-    else
+    boost::container::small_vector<std::array<double, 4>, 100>
+      weights_vertices(n_points);
+    for (unsigned int p = 0; p < n_points; ++p)
+      weights_vertices[p] = {{(1. - chart_points[p][0]) *
+                                (1. - chart_points[p][1]),
+                              chart_points[p][0] * (1. - chart_points[p][1]),
+                              (1. - chart_points[p][0]) * chart_points[p][1],
+                              chart_points[p][0] * chart_points[p][1]}};
+
+    for (unsigned int p = 0; p < n_points; ++p)
+      new_points[p] = Point<spacedim>();
+
+    if (cell_is_flat == false)
       {
         // The second line in the formula tells us to subtract the
         // contribution of the vertices.  If a line employs the same manifold
@@ -1759,19 +1859,16 @@ namespace
 
         // add the contribution from the lines around the cell (first line in
         // formula)
-        std::array<double, GeometryInfo<2>::vertices_per_face>          weights;
-        std::array<Point<spacedim>, GeometryInfo<2>::vertices_per_face> points;
-        // note that the views are immutable, but the arrays are not
-        const auto weights_view =
-          make_array_view(weights.begin(), weights.end());
-        const auto points_view = make_array_view(points.begin(), points.end());
-
+        Table<2, double>                                     weights;
+        std::array<Point<spacedim>, 2>                       points;
+        boost::container::small_vector<Point<spacedim>, 100> line_points;
         for (unsigned int line = 0; line < GeometryInfo<2>::lines_per_cell;
              ++line)
           {
-            const double my_weight =
-              (line % 2) ? chart_point[line / 2] : 1 - chart_point[line / 2];
-            const double line_point = chart_point[1 - line / 2];
+            const unsigned int v0 =
+              GeometryInfo<2>::line_to_cell_vertices(line, 0);
+            const unsigned int v1 =
+              GeometryInfo<2>::line_to_cell_vertices(line, 1);
 
             // Same manifold or invalid id which will go back to the same
             // class -> contribution should be added for the final point,
@@ -1781,68 +1878,67 @@ namespace
               cell.line(line)->manifold_id();
             if (line_manifold_id == my_manifold_id ||
                 line_manifold_id == numbers::flat_manifold_id)
-              {
-                weights_vertices[GeometryInfo<2>::line_to_cell_vertices(line,
-                                                                        0)] -=
-                  my_weight * (1. - line_point);
-                weights_vertices[GeometryInfo<2>::line_to_cell_vertices(line,
-                                                                        1)] -=
-                  my_weight * line_point;
-              }
+              for (unsigned int p = 0; p < n_points; ++p)
+                {
+                  const double my_weight =
+                    (line % 2) ? chart_points[p][line / 2] :
+                                 1 - chart_points[p][line / 2];
+                  const double line_point = chart_points[p][1 - line / 2];
+                  weights_vertices[p][v0] -= my_weight * (1. - line_point);
+                  weights_vertices[p][v1] -= my_weight * line_point;
+                }
             else
               {
-                points[0] =
-                  vertices[GeometryInfo<2>::line_to_cell_vertices(line, 0)];
-                points[1] =
-                  vertices[GeometryInfo<2>::line_to_cell_vertices(line, 1)];
-                weights[0] = 1. - line_point;
-                weights[1] = line_point;
-                new_point +=
-                  my_weight * tria.get_manifold(line_manifold_id)
-                                .get_new_point(points_view, weights_view);
+                points[0] = vertices[v0];
+                points[1] = vertices[v1];
+                compute_points_on_object(
+                  tria.get_manifold(line_manifold_id),
+                  points,
+                  n_points,
+                  [&](const unsigned int p) {
+                    const double line_point = chart_points[p][1 - line / 2];
+                    return std::array<double, 2>{{1. - line_point, line_point}};
+                  },
+                  weights,
+                  line_points);
+                for (unsigned int p = 0; p < n_points; ++p)
+                  {
+                    const double my_weight =
+                      (line % 2) ? chart_points[p][line / 2] :
+                                   1 - chart_points[p][line / 2];
+                    new_points[p] += my_weight * line_points[p];
+                  }
               }
           }
 
         // subtract contribution from the vertices (second line in formula)
-        for (const unsigned int v : GeometryInfo<2>::vertex_indices())
-          new_point -= weights_vertices[v] * vertices[v];
+        for (unsigned int p = 0; p < n_points; ++p)
+          for (const unsigned int v : GeometryInfo<2>::vertex_indices())
+            new_points[p] -= weights_vertices[p][v] * vertices[v];
       }
-
-    return new_point;
+    else
+      for (unsigned int p = 0; p < n_points; ++p)
+        for (const unsigned int v : GeometryInfo<2>::vertex_indices())
+          new_points[p] += weights_vertices[p][v] * vertices[v];
   }
 
-  // this is replicated from GeometryInfo::face_to_cell_vertices since we need
-  // it very often in compute_transfinite_interpolation and the function is
-  // performance critical
-  static constexpr unsigned int face_to_cell_vertices_3d[6][4] = {{0, 2, 4, 6},
-                                                                  {1, 3, 5, 7},
-                                                                  {0, 4, 1, 5},
-                                                                  {2, 6, 3, 7},
-                                                                  {0, 1, 2, 3},
-                                                                  {4, 5, 6, 7}};
-
-  // this is replicated from GeometryInfo::face_to_cell_lines since we need it
-  // very often in compute_transfinite_interpolation and the function is
-  // performance critical
-  static constexpr unsigned int face_to_cell_lines_3d[6][4] = {{8, 10, 0, 4},
-                                                               {9, 11, 1, 5},
-                                                               {2, 6, 8, 9},
-                                                               {3, 7, 10, 11},
-                                                               {0, 1, 2, 3},
-                                                               {4, 5, 6, 7}};
-
   // version for 3d
   template <typename AccessorType>
-  Point<AccessorType::space_dimension>
-  compute_transfinite_interpolation(const AccessorType &cell,
-                                    const Point<3>     &chart_point,
-                                    const bool          cell_is_flat)
+  void
+  compute_transfinite_interpolation(
+    const AccessorType                                    &cell,
+    const ArrayView<const Point<3>>                       &chart_points,
+    const bool                                             cell_is_flat,
+    const ArrayView<Point<AccessorType::space_dimension>> &new_points)
   {
     const unsigned int       dim             = AccessorType::dimension;
     const unsigned int       spacedim        = AccessorType::space_dimension;
     const types::manifold_id my_manifold_id  = cell.manifold_id();
     const Triangulation<dim, spacedim> &tria = cell.get_triangulation();
 
+    const unsigned int n_points = chart_points.size();
+    AssertDimension(n_points, new_points.size());
+
     // Same approach as in 2d, but adding the faces, subtracting the edges, and
     // adding the vertices
     const std::array<Point<spacedim>, 8> vertices{{cell.vertex(0),
@@ -1857,157 +1953,212 @@ namespace
     // store the components of the linear shape functions because we need them
     // repeatedly. we allow for 10 such shape functions to wrap around the
     // first four once again for easier face access.
-    double linear_shapes[10];
-    for (unsigned int d = 0; d < 3; ++d)
+    boost::container::small_vector<std::array<double, 10>, 100> linear_shapes(
+      n_points);
+    boost::container::small_vector<std::array<double, 8>, 100>
+      weights_vertices(n_points);
+    for (unsigned int p = 0; p < n_points; ++p)
       {
-        linear_shapes[2 * d]     = 1. - chart_point[d];
-        linear_shapes[2 * d + 1] = chart_point[d];
-      }
+        for (unsigned int d = 0; d < 3; ++d)
+          {
+            linear_shapes[p][2 * d]     = 1. - chart_points[p][d];
+            linear_shapes[p][2 * d + 1] = chart_points[p][d];
+          }
 
-    // wrap linear shape functions around for access in face loop
-    for (unsigned int d = 6; d < 10; ++d)
-      linear_shapes[d] = linear_shapes[d - 6];
+        // wrap linear shape functions around for access in face loop
+        for (unsigned int d = 6; d < 10; ++d)
+          linear_shapes[p][d] = linear_shapes[p][d - 6];
+
+        for (unsigned int i2 = 0, v = 0; i2 < 2; ++i2)
+          for (unsigned int i1 = 0; i1 < 2; ++i1)
+            for (unsigned int i0 = 0; i0 < 2; ++i0, ++v)
+              weights_vertices[p][v] =
+                (linear_shapes[p][4 + i2] * linear_shapes[p][2 + i1]) *
+                linear_shapes[p][i0];
+      }
 
-    std::array<double, 8> weights_vertices;
-    for (unsigned int i2 = 0, v = 0; i2 < 2; ++i2)
-      for (unsigned int i1 = 0; i1 < 2; ++i1)
-        for (unsigned int i0 = 0; i0 < 2; ++i0, ++v)
-          weights_vertices[v] =
-            (linear_shapes[4 + i2] * linear_shapes[2 + i1]) * linear_shapes[i0];
+    for (unsigned int p = 0; p < n_points; ++p)
+      new_points[p] = Point<spacedim>();
 
-    Point<spacedim> new_point;
     if (cell_is_flat)
-      for (unsigned int v = 0; v < 8; ++v)
-        new_point += weights_vertices[v] * vertices[v];
-    else
       {
-        // identify the weights for the lines to be accumulated (vertex
-        // weights are set outside and coincide with the flat manifold case)
-
-        std::array<double, GeometryInfo<3>::lines_per_cell> weights_lines;
-        std::fill(weights_lines.begin(), weights_lines.end(), 0.0);
-
-        // start with the contributions of the faces
-        std::array<double, GeometryInfo<2>::vertices_per_cell>          weights;
-        std::array<Point<spacedim>, GeometryInfo<2>::vertices_per_cell> points;
-        // note that the views are immutable, but the arrays are not
-        const auto weights_view =
-          make_array_view(weights.begin(), weights.end());
-        const auto points_view = make_array_view(points.begin(), points.end());
+        for (unsigned int p = 0; p < n_points; ++p)
+          for (unsigned int v = 0; v < 8; ++v)
+            new_points[p] += weights_vertices[p][v] * vertices[v];
+        return;
+      }
 
-        for (const unsigned int face : GeometryInfo<3>::face_indices())
+    // identify the weights for the lines to be accumulated (vertex weights
+    // are set above and coincide with the flat manifold case)
+    boost::container::small_vector<std::array<double, 12>, 100> weights_lines(
+      n_points);
+    for (unsigned int p = 0; p < n_points; ++p)
+      std::fill(weights_lines[p].begin(), weights_lines[p].end(), 0.0);
+
+    // the points (among all points) that get a contribution from the current
+    // face or line and the new points on the face or line
+    Table<2, double>                                     weights;
+    std::array<Point<spacedim>, 4>                       face_points;
+    std::array<Point<spacedim>, 2>                       line_points;
+    boost::container::small_vector<unsigned int, 100>    active_points;
+    boost::container::small_vector<Point<spacedim>, 100> sub_points;
+
+    // start with the contributions of the faces
+    for (const unsigned int face : GeometryInfo<3>::face_indices())
+      {
+        const unsigned int face_even = face - face % 2;
+
+        // same manifold or invalid id which will go back to the same class
+        // -> face will interpolate from the surrounding lines and vertices
+        const types::manifold_id face_manifold_id =
+          cell.face(face)->manifold_id();
+        if (face_manifold_id == my_manifold_id ||
+            face_manifold_id == numbers::flat_manifold_id)
           {
-            const double       my_weight = linear_shapes[face];
-            const unsigned int face_even = face - face % 2;
-
-            if (std::abs(my_weight) < 1e-13)
-              continue;
-
-            // same manifold or invalid id which will go back to the same class
-            // -> face will interpolate from the surrounding lines and vertices
-            const types::manifold_id face_manifold_id =
-              cell.face(face)->manifold_id();
-            if (face_manifold_id == my_manifold_id ||
-                face_manifold_id == numbers::flat_manifold_id)
+            for (unsigned int p = 0; p < n_points; ++p)
               {
+                const auto  &shapes    = linear_shapes[p];
+                const double my_weight = shapes[face];
+                if (std::abs(my_weight) < 1e-13)
+                  continue;
+
                 for (unsigned int line = 0;
                      line < GeometryInfo<2>::lines_per_cell;
                      ++line)
-                  {
-                    const double line_weight =
-                      linear_shapes[face_even + 2 + line];
-                    weights_lines[face_to_cell_lines_3d[face][line]] +=
-                      my_weight * line_weight;
-                  }
+                  weights_lines[p][face_to_cell_lines_3d[face][line]] +=
+                    my_weight * shapes[face_even + 2 + line];
                 // as to the indices inside linear_shapes: we use the index
                 // wrapped around at 2*d, ensuring the correct orientation of
                 // the face's coordinate system with respect to the
                 // lexicographic indices
-                weights_vertices[face_to_cell_vertices_3d[face][0]] -=
-                  linear_shapes[face_even + 2] *
-                  (linear_shapes[face_even + 4] * my_weight);
-                weights_vertices[face_to_cell_vertices_3d[face][1]] -=
-                  linear_shapes[face_even + 3] *
-                  (linear_shapes[face_even + 4] * my_weight);
-                weights_vertices[face_to_cell_vertices_3d[face][2]] -=
-                  linear_shapes[face_even + 2] *
-                  (linear_shapes[face_even + 5] * my_weight);
-                weights_vertices[face_to_cell_vertices_3d[face][3]] -=
-                  linear_shapes[face_even + 3] *
-                  (linear_shapes[face_even + 5] * my_weight);
-              }
-            else
-              {
-                for (const unsigned int v : GeometryInfo<2>::vertex_indices())
-                  points[v] = vertices[face_to_cell_vertices_3d[face][v]];
-                weights[0] =
-                  linear_shapes[face_even + 2] * linear_shapes[face_even + 4];
-                weights[1] =
-                  linear_shapes[face_even + 3] * linear_shapes[face_even + 4];
-                weights[2] =
-                  linear_shapes[face_even + 2] * linear_shapes[face_even + 5];
-                weights[3] =
-                  linear_shapes[face_even + 3] * linear_shapes[face_even + 5];
-                new_point +=
-                  my_weight * tria.get_manifold(face_manifold_id)
-                                .get_new_point(points_view, weights_view);
+                weights_vertices[p][face_to_cell_vertices_3d[face][0]] -=
+                  shapes[face_even + 2] * (shapes[face_even + 4] * my_weight);
+                weights_vertices[p][face_to_cell_vertices_3d[face][1]] -=
+                  shapes[face_even + 3] * (shapes[face_even + 4] * my_weight);
+                weights_vertices[p][face_to_cell_vertices_3d[face][2]] -=
+                  shapes[face_even + 2] * (shapes[face_even + 5] * my_weight);
+                weights_vertices[p][face_to_cell_vertices_3d[face][3]] -=
+                  shapes[face_even + 3] * (shapes[face_even + 5] * my_weight);
               }
           }
-
-        // next subtract the contributions of the lines
-        const auto weights_view_line =
-          make_array_view(weights.begin(), weights.begin() + 2);
-        const auto points_view_line =
-          make_array_view(points.begin(), points.begin() + 2);
-        for (unsigned int line = 0; line < GeometryInfo<3>::lines_per_cell;
-             ++line)
+        else
           {
-            const double line_point =
-              (line < 8 ? chart_point[1 - (line % 4) / 2] : chart_point[2]);
-            double my_weight = 0.;
-            if (line < 8)
-              my_weight = linear_shapes[line % 4] * linear_shapes[4 + line / 4];
-            else
-              {
-                const unsigned int subline = line - 8;
-                my_weight =
-                  linear_shapes[subline % 2] * linear_shapes[2 + subline / 2];
-              }
-            my_weight -= weights_lines[line];
-
-            if (std::abs(my_weight) < 1e-13)
+            active_points.clear();
+            for (unsigned int p = 0; p < n_points; ++p)
+              if (std::abs(linear_shapes[p][face]) >= 1e-13)
+                active_points.push_back(p);
+            if (active_points.empty())
               continue;
 
-            const types::manifold_id line_manifold_id =
-              cell.line(line)->manifold_id();
-            if (line_manifold_id == my_manifold_id ||
-                line_manifold_id == numbers::flat_manifold_id)
-              {
-                weights_vertices[GeometryInfo<3>::line_to_cell_vertices(line,
-                                                                        0)] -=
-                  my_weight * (1. - line_point);
-                weights_vertices[GeometryInfo<3>::line_to_cell_vertices(line,
-                                                                        1)] -=
-                  my_weight * (line_point);
-              }
-            else
+            for (const unsigned int v : GeometryInfo<2>::vertex_indices())
+              face_points[v] = vertices[face_to_cell_vertices_3d[face][v]];
+            compute_points_on_object(
+              tria.get_manifold(face_manifold_id),
+              face_points,
+              active_points.size(),
+              [&](const unsigned int i) {
+                const auto &shapes = linear_shapes[active_points[i]];
+                return std::array<double, 4>{
+                  {shapes[face_even + 2] * shapes[face_even + 4],
+                   shapes[face_even + 3] * shapes[face_even + 4],
+                   shapes[face_even + 2] * shapes[face_even + 5],
+                   shapes[face_even + 3] * shapes[face_even + 5]}};
+              },
+              weights,
+              sub_points);
+            for (unsigned int i = 0; i < active_points.size(); ++i)
+              new_points[active_points[i]] +=
+                linear_shapes[active_points[i]][face] * sub_points[i];
+          }
+      }
+
+    // next subtract the contributions of the lines
+    const auto line_weight = [&](const unsigned int p,
+                                 const unsigned int line) {
+      double my_weight = 0.;
+      if (line < 8)
+        my_weight =
+          linear_shapes[p][line % 4] * linear_shapes[p][4 + line / 4];
+      else
+        {
+          const unsigned int subline = line - 8;
+          my_weight =
+            linear_shapes[p][subline % 2] * linear_shapes[p][2 + subline / 2];
+        }
+      return my_weight - weights_lines[p][line];
+    };
+    for (unsigned int line = 0; line < GeometryInfo<3>::lines_per_cell; ++line)
+      {
+        const unsigned int v0 = GeometryInfo<3>::line_to_cell_vertices(line, 0);
+        const unsigned int v1 = GeometryInfo<3>::line_to_cell_vertices(line, 1);
+
+        // the coordinate of the chart point along the line
+        const unsigned int coordinate = line < 8 ? 1 - (line % 4) / 2 : 2;
+
+        const types::manifold_id line_manifold_id =
+          cell.line(line)->manifold_id();
+        if (line_manifold_id == my_manifold_id ||
+            line_manifold_id == numbers::flat_manifold_id)
+          {
+            for (unsigned int p = 0; p < n_points; ++p)
               {
-                points[0] =
-                  vertices[GeometryInfo<3>::line_to_cell_vertices(line, 0)];
-                points[1] =
-                  vertices[GeometryInfo<3>::line_to_cell_vertices(line, 1)];
-                weights[0] = 1. - line_point;
-                weights[1] = line_point;
-                new_point -= my_weight * tria.get_manifold(line_manifold_id)
-                                           .get_new_point(points_view_line,
-                                                          weights_view_line);
+                const double my_weight = line_weight(p, line);
+                if (std::abs(my_weight) < 1e-13)
+                  continue;
+
+                const double line_point = chart_points[p][coordinate];
+                weights_vertices[p][v0] -= my_weight * (1. - line_point);
+                weights_vertices[p][v1] -= my_weight * (line_point);
               }
           }
+        else
+          {
+            active_points.clear();
+            for (unsigned int p = 0; p < n_points; ++p)
+              if (std::abs(line_weight(p, line)) >= 1e-13)
+                active_points.push_back(p);
+            if (active_points.empty())
+              continue;
 
-        // finally add the contribution of the
-        for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
-          new_point += weights_vertices[v] * vertices[v];
+            line_points[0] = vertices[v0];
+            line_points[1] = vertices[v1];
+            compute_points_on_object(
+              tria.get_manifold(line_manifold_id),
+              line_points,
+              active_points.size(),
+              [&](const unsigned int i) {
+                const double line_point =
+                  chart_points[active_points[i]][coordinate];
+                return std::array<double, 2>{{1. - line_point, line_point}};
+              },
+              weights,
+              sub_points);
+            for (unsigned int i = 0; i < active_points.size(); ++i)
+              new_points[active_points[i]] -=
+                line_weight(active_points[i], line) * sub_points[i];
+          }
       }
+
+    // finally add the contribution of the vertices
+    for (unsigned int p = 0; p < n_points; ++p)
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        new_points[p] += weights_vertices[p][v] * vertices[v];
+  }
+
+  // version for a single point in 2d and 3d, which calls the functions above
+  template <typename AccessorType, int chartdim>
+  Point<AccessorType::space_dimension>
+  compute_transfinite_interpolation(const AccessorType    &cell,
+                                    const Point<chartdim> &chart_point,
+                                    const bool             cell_is_flat)
+  {
+    Point<AccessorType::space_dimension> new_point;
+    compute_transfinite_interpolation(cell,
+                                      make_array_view(&chart_point,
+                                                      &chart_point + 1),
+                                      cell_is_flat,
+                                      make_array_view(&new_point,
+                                                      &new_point + 1));
     return new_point;
   }
 } // namespace
@@ -2604,8 +2755,21 @@ TransfiniteInterpolationManifold<dim, spacedim>::get_new_points(
                                 make_array_view(new_points_on_chart.begin(),
                                                 new_points_on_chart.end()));
 
+  // check that the points are in the unit cell which is the current chart,
+  // see push_forward(), and compute all points on the cell at once
+  AssertDimension(cell->level(), level_coarse);
   for (unsigned int row = 0; row < weights.size(0); ++row)
-    new_points[row] = push_forward(cell, new_points_on_chart[row]);
+    Assert(GeometryInfo<dim>::is_inside_unit_cell(new_points_on_chart[row],
+                                                  5e-4),
+           ExcMessage("chart_point is not in unit interval"));
+
+  compute_transfinite_interpolation(
+    *cell,
+    make_array_view(std::as_const(new_points_on_chart).begin(),
+                    std::as_const(new_points_on_chart).end()),
+    coarse_cell_is_flat[cell->index()],
+    make_array_view(new_points.begin(),
+                    new_points.begin() + weights.size(0)));
 }
 
 
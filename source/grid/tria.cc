@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -759,92 +760,6 @@ namespace internal
           ierr = MPI_File_close(&fh);
           AssertThrowMPI(ierr);
         }
-
-
-
-        //
-        // ---------- Variable size data ----------
-        //
-        if (variable_size_data_stored)
-          {
-            const std::string fname_variable =
-              std::string(file_basename) + "_variable.data";
-
-            MPI_Info info;
-            int      ierr = MPI_Info_create(&info);
-            AssertThrowMPI(ierr);
-
-            MPI_File fh;
-            ierr = MPI_File_open(mpi_communicator,
-                                 fname_variable.c_str(),
-                                 MPI_MODE_CREATE | MPI_MODE_WRONLY,
-                                 info,
-                                 &fh);
-            AssertThrowMPI(ierr);
-
-            ierr = MPI_File_set_size(fh, 0); // delete the file contents
-            AssertThrowMPI(ierr);
-            // this barrier is necessary, because otherwise others might already
-            // write while one core is still setting the size to zero.
-            ierr = MPI_Barrier(mpi_communicator);
-            AssertThrowMPI(ierr);
-            ierr = MPI_Info_free(&info);
-            AssertThrowMPI(ierr);
-
-            // Write sizes of each cell into file simultaneously.
-            {
-              const MPI_Offset my_global_file_position =
-                static_cast<MPI_Offset>(global_first_cell) *
-                sizeof(unsigned int);
-
-              // It is very unlikely that a single process has more than
-              // 2 billion cells, but we might as well check.
-              AssertThrow(src_sizes_variable.size() <
-                            static_cast<std::size_t>(
-                              std::numeric_limits<int>::max()),
-                          ExcNotImplemented());
-
-              ierr = Utilities::MPI::LargeCount::File_write_at_c(
-                fh,
-                my_global_file_position,
-                src_sizes_variable.data(),
-                src_sizes_variable.size(),
-                MPI_INT,
-                MPI_STATUS_IGNORE);
-              AssertThrowMPI(ierr);
-            }
-
-            // Gather size of data in bytes we want to store from this
-            // processor and compute the prefix sum. We do this in 64 bit
-            // to avoid overflow for files larger than 4GB:
-            const std::uint64_t size_on_proc = src_data_variable.size();
-            std::uint64_t       prefix_sum   = 0;
-            ierr                             = MPI_Exscan(&size_on_proc,
-                              &prefix_sum,
-                              1,
-                              MPI_UINT64_T,
-                              MPI_SUM,
-                              mpi_communicator);
-            AssertThrowMPI(ierr);
-
-            const MPI_Offset my_global_file_position =
-              static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
-              prefix_sum;
-
-            // Write data consecutively into file.
-            ierr = Utilities::MPI::LargeCount::File_write_at_c(
-              fh,
-              my_global_file_position,
-              src_data_variable.data(),
-              src_data_variable.size(),
-              MPI_BYTE,
-              MPI_STATUS_IGNORE);
-            AssertThrowMPI(ierr);
-
-
-            ierr = MPI_File_close(&fh);
-            AssertThrowMPI(ierr);
-          }
       } // if (mpisize > 1)
     else
 #endif
@@ -872,32 +787,133 @@ namespace internal
           file.write(reinterpret_cast<const char *>(src_data_fixed.data()),
                      src_data_fixed.size() * sizeof(char));
         }
+      }
+
+    if (variable_size_data_stored)
+      save_variable_size_data(global_first_cell,
+                              global_num_cells,
+                              file_basename,
+                              mpi_communicator);
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::save_variable_size_data(
+    const unsigned int global_first_cell,
+    const unsigned int global_num_cells,
+    const std::string &file_basename,
+    const MPI_Comm    &mpi_communicator) const
+  {
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int mpisize =
+      Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    if (mpisize > 1)
+      {
+        const std::string fname_variable =
+          std::string(file_basename) + "_variable.data";
+
+        MPI_Info info;
+        int      ierr = MPI_Info_create(&info);
+        AssertThrowMPI(ierr);
+
+        MPI_File fh;
+        ierr = MPI_File_open(mpi_communicator,
+                             fname_variable.c_str(),
+                             MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                             info,
+                             &fh);
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_File_set_size(fh, 0); // delete the file contents
+        AssertThrowMPI(ierr);
+        // this barrier is necessary, because otherwise others might already
+        // write while one core is still setting the size to zero.
+        ierr = MPI_Barrier(mpi_communicator);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Info_free(&info);
+        AssertThrowMPI(ierr);
+
+        // Write sizes of each cell into file simultaneously.
+        {
+          const MPI_Offset my_global_file_position =
+            static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
+
+          // It is very unlikely that a single process has more than
+          // 2 billion cells, but we might as well check.
+          AssertThrow(src_sizes_variable.size() <
+                        static_cast<std::size_t>(
+                          std::numeric_limits<int>::max()),
+                      ExcNotImplemented());
+
+          ierr = Utilities::MPI::LargeCount::File_write_at_c(
+            fh,
+            my_global_file_position,
+            src_sizes_variable.data(),
+            src_sizes_variable.size(),
+            MPI_INT,
+            MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
 
-        //
-        // ---------- Variable size data ----------
-        //
-        if (variable_size_data_stored)
-          {
-            const std::string fname_variable =
-              std::string(file_basename) + "_variable.data";
+        // Gather size of data in bytes we want to store from this
+        // processor and compute the prefix sum. We do this in 64 bit
+        // to avoid overflow for files larger than 4GB:
+        const std::uint64_t size_on_proc = src_data_variable.size();
+        std::uint64_t       prefix_sum   = 0;
+        ierr                             = MPI_Exscan(&size_on_proc,
+                          &prefix_sum,
+                          1,
+                          MPI_UINT64_T,
+                          MPI_SUM,
+                          mpi_communicator);
+        AssertThrowMPI(ierr);
+
+        const MPI_Offset my_global_file_position =
+          static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
+          prefix_sum;
+
+        // Write data consecutively into file.
+        ierr = Utilities::MPI::LargeCount::File_write_at_c(
+          fh,
+          my_global_file_position,
+          src_data_variable.data(),
+          src_data_variable.size(),
+          MPI_BYTE,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+
+        ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
+      }
+    else // if (mpisize > 1)
+#endif
+      {
+        (void)global_first_cell;
+        (void)global_num_cells;
+        (void)mpi_communicator;
 
-            std::ofstream file(fname_variable,
-                               std::ios::binary | std::ios::out);
-            AssertThrow(file.fail() == false, ExcIO());
+        const std::string fname_variable =
+          std::string(file_basename) + "_variable.data";
 
-            // Write header data.
-            file.write(reinterpret_cast<const char *>(
-                         src_sizes_variable.data()),
-                       src_sizes_variable.size() * sizeof(int));
+        std::ofstream file(fname_variable, std::ios::binary | std::ios::out);
+        AssertThrow(file.fail() == false, ExcIO());
 
-            // Write packed data.
-            file.write(reinterpret_cast<const char *>(src_data_variable.data()),
-                       src_data_variable.size() * sizeof(char));
-          }
+        // Write header data.
+        file.write(reinterpret_cast<const char *>(src_sizes_variable.data()),
+                   src_sizes_variable.size() * sizeof(int));
+
+        // Write packed data.
+        file.write(reinterpret_cast<const char *>(src_data_variable.data()),
+                   src_data_variable.size() * sizeof(char));
       }
   }
 
 
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::load(
@@ -986,143 +1002,539 @@ namespace internal
           ierr = MPI_File_close(&fh);
           AssertThrowMPI(ierr);
         }
+      }
+    else // if (mpisize > 1)
+#endif
+      {
+        (void)global_first_cell;
+        (void)global_num_cells;
+        (void)mpi_communicator;
 
         //
-        // ---------- Variable size data ----------
+        // ---------- Fixed size data ----------
         //
-        if (variable_size_data_stored)
-          {
-            const std::string fname_variable =
-              std::string(file_basename) + "_variable.data";
+        {
+          const std::string fname_fixed =
+            std::string(file_basename) + "_fixed.data";
+
+          std::ifstream file(fname_fixed, std::ios::binary | std::ios::in);
+          AssertThrow(file.fail() == false, ExcIO());
+
+          sizes_fixed_cumulative.resize(1 + n_attached_deserialize_fixed +
+                                        (variable_size_data_stored ? 1 : 0));
+
+          // Read header data.
+          file.read(reinterpret_cast<char *>(sizes_fixed_cumulative.data()),
+                    sizes_fixed_cumulative.size() * sizeof(unsigned int));
+
+          const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
+          dest_data_fixed.resize(static_cast<size_t>(local_num_cells) *
+                                 bytes_per_cell);
+
+          // Read packed data.
+          file.read(reinterpret_cast<char *>(dest_data_fixed.data()),
+                    dest_data_fixed.size() * sizeof(char));
+        }
+      }
+
+    if (variable_size_data_stored)
+      load_variable_size_data(global_first_cell,
+                              global_num_cells,
+                              local_num_cells,
+                              file_basename,
+                              mpi_communicator);
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::load_variable_size_data(
+    const unsigned int global_first_cell,
+    const unsigned int global_num_cells,
+    const unsigned int local_num_cells,
+    const std::string &file_basename,
+    const MPI_Comm    &mpi_communicator)
+  {
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int mpisize =
+      Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    if (mpisize > 1)
+      {
+        const std::string fname_variable =
+          std::string(file_basename) + "_variable.data";
+
+        MPI_Info info;
+        int      ierr = MPI_Info_create(&info);
+        AssertThrowMPI(ierr);
+
+        MPI_File fh;
+        ierr = MPI_File_open(mpi_communicator,
+                             fname_variable.c_str(),
+                             MPI_MODE_RDONLY,
+                             info,
+                             &fh);
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_Info_free(&info);
+        AssertThrowMPI(ierr);
+
+        // Read sizes of all locally owned cells.
+        dest_sizes_variable.resize(local_num_cells);
+
+        const MPI_Offset my_global_file_position_sizes =
+          static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
+
+        ierr = Utilities::MPI::LargeCount::File_read_at_c(
+          fh,
+          my_global_file_position_sizes,
+          dest_sizes_variable.data(),
+          dest_sizes_variable.size(),
+          MPI_INT,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+
+        // Compute my data size in bytes and compute prefix sum. We do this
+        // in 64 bit to avoid overflow for files larger than 4 GB:
+        const std::uint64_t size_on_proc =
+          std::accumulate(dest_sizes_variable.begin(),
+                          dest_sizes_variable.end(),
+                          0ULL);
+
+        std::uint64_t prefix_sum = 0;
+        ierr                     = MPI_Exscan(&size_on_proc,
+                          &prefix_sum,
+                          1,
+                          MPI_UINT64_T,
+                          MPI_SUM,
+                          mpi_communicator);
+        AssertThrowMPI(ierr);
+
+        const MPI_Offset my_global_file_position =
+          static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
+          prefix_sum;
+
+        dest_data_variable.resize(size_on_proc);
+
+        ierr = Utilities::MPI::LargeCount::File_read_at_c(
+          fh,
+          my_global_file_position,
+          dest_data_variable.data(),
+          dest_data_variable.size(),
+          MPI_BYTE,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
+      }
+    else // if (mpisize > 1)
+#endif
+      {
+        (void)global_first_cell;
+        (void)global_num_cells;
+        (void)mpi_communicator;
+
+        const std::string fname_variable =
+          std::string(file_basename) + "_variable.data";
+
+        std::ifstream file(fname_variable, std::ios::binary | std::ios::in);
+        AssertThrow(file.fail() == false, ExcIO());
+
+        // Read header data.
+        dest_sizes_variable.resize(local_num_cells);
+        file.read(reinterpret_cast<char *>(dest_sizes_variable.data()),
+                  dest_sizes_variable.size() * sizeof(int));
+
+        // Read packed data.
+        const std::uint64_t size =
+          std::accumulate(dest_sizes_variable.begin(),
+                          dest_sizes_variable.end(),
+                          0ULL);
+        dest_data_variable.resize(size);
+        file.read(reinterpret_cast<char *>(dest_data_variable.data()),
+                  dest_data_variable.size() * sizeof(char));
+      }
+  }
+
+
+
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::save_indexed(
+    const unsigned int global_first_cell,
+    const unsigned int global_num_cells,
+    const std::string &file_basename,
+    const MPI_Comm    &mpi_communicator) const
+  {
+    Assert(sizes_fixed_cumulative.size() > 0,
+           ExcMessage("No data has been packed!"));
+
+    const unsigned int n_fields       = sizes_fixed_cumulative.size();
+    const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
+    const std::size_t  local_num_cells =
+      (bytes_per_cell > 0) ? src_data_fixed.size() / bytes_per_cell : 0;
+
+    // The header consists of the number of fields, the cumulative sizes of
+    // the fields per cell, and the position of each field's block within the
+    // file. Each block stores the data of one field for all cells, ordered by
+    // their global index.
+    const auto field_size = [&](const unsigned int f) {
+      return sizes_fixed_cumulative[f] -
+             (f == 0 ? 0 : sizes_fixed_cumulative[f - 1]);
+    };
 
-            MPI_Info info;
-            int      ierr = MPI_Info_create(&info);
+    std::vector<std::uint64_t> field_offsets(n_fields);
+    {
+      std::uint64_t offset = (1 + n_fields) * sizeof(unsigned int) +
+                             n_fields * sizeof(std::uint64_t);
+      for (unsigned int f = 0; f < n_fields; ++f)
+        {
+          field_offsets[f] = offset;
+          offset +=
+            static_cast<std::uint64_t>(global_num_cells) * field_size(f);
+        }
+    }
+
+    // Copy the data of one field on all locally owned cells into a
+    // contiguous buffer.
+    const auto extract_field = [&](const unsigned int f) {
+      const unsigned int field_begin =
+        (f == 0) ? 0 : sizes_fixed_cumulative[f - 1];
+
+      std::vector<char> buffer(local_num_cells * field_size(f));
+      for (std::size_t c = 0; c < local_num_cells; ++c)
+        std::memcpy(buffer.data() + c * field_size(f),
+                    src_data_fixed.data() + c * bytes_per_cell + field_begin,
+                    field_size(f));
+      return buffer;
+    };
+
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int myrank =
+      Utilities::MPI::this_mpi_process(mpi_communicator);
+    const unsigned int mpisize =
+      Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    if (mpisize > 1)
+      {
+        const std::string fname_fixed =
+          std::string(file_basename) + "_fixed.data";
+
+        MPI_Info info;
+        int      ierr = MPI_Info_create(&info);
+        AssertThrowMPI(ierr);
+
+        MPI_File fh;
+        ierr = MPI_File_open(mpi_communicator,
+                             fname_fixed.c_str(),
+                             MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                             info,
+                             &fh);
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_File_set_size(fh, 0); // delete the file contents
+        AssertThrowMPI(ierr);
+        // this barrier is necessary, because otherwise others might already
+        // write while one core is still setting the size to zero.
+        ierr = MPI_Barrier(mpi_communicator);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Info_free(&info);
+        AssertThrowMPI(ierr);
+
+        // The header is identical on all processes, so let only the first
+        // one write it.
+        if (myrank == 0)
+          {
+            ierr = MPI_File_write_at(
+              fh, 0, &n_fields, 1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
             AssertThrowMPI(ierr);
 
-            MPI_File fh;
-            ierr = MPI_File_open(mpi_communicator,
-                                 fname_variable.c_str(),
-                                 MPI_MODE_RDONLY,
-                                 info,
-                                 &fh);
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              sizeof(unsigned int),
+              sizes_fixed_cumulative.data(),
+              n_fields,
+              MPI_UNSIGNED,
+              MPI_STATUS_IGNORE);
             AssertThrowMPI(ierr);
 
-            ierr = MPI_Info_free(&info);
+            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              fh,
+              (1 + n_fields) * sizeof(unsigned int),
+              field_offsets.data(),
+              n_fields,
+              MPI_UINT64_T,
+              MPI_STATUS_IGNORE);
             AssertThrowMPI(ierr);
+          }
 
-            // Read sizes of all locally owned cells.
-            dest_sizes_variable.resize(local_num_cells);
+        // Write the blocks field by field. Every process writes its range
+        // of cells of each field with one contiguous, collective call.
+        for (unsigned int f = 0; f < n_fields; ++f)
+          {
+            const std::vector<char> buffer = extract_field(f);
 
-            const MPI_Offset my_global_file_position_sizes =
-              static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
+            const MPI_Offset my_global_file_position =
+              field_offsets[f] +
+              static_cast<MPI_Offset>(global_first_cell) * field_size(f);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
               fh,
-              my_global_file_position_sizes,
-              dest_sizes_variable.data(),
-              dest_sizes_variable.size(),
-              MPI_INT,
+              my_global_file_position,
+              buffer.data(),
+              buffer.size(),
+              MPI_BYTE,
               MPI_STATUS_IGNORE);
             AssertThrowMPI(ierr);
+          }
+
+        ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
+      }
+    else // if (mpisize > 1)
+#endif
+      {
+        (void)global_first_cell;
+        (void)mpi_communicator;
 
+        const std::string fname_fixed =
+          std::string(file_basename) + "_fixed.data";
 
-            // Compute my data size in bytes and compute prefix sum. We do this
-            // in 64 bit to avoid overflow for files larger than 4 GB:
-            const std::uint64_t size_on_proc =
-              std::accumulate(dest_sizes_variable.begin(),
-                              dest_sizes_variable.end(),
-                              0ULL);
+        std::ofstream file(fname_fixed, std::ios::binary | std::ios::out);
+        AssertThrow(file.fail() == false, ExcIO());
+
+        // Write header data.
+        file.write(reinterpret_cast<const char *>(&n_fields),
+                   sizeof(unsigned int));
+        file.write(reinterpret_cast<const char *>(
+                     sizes_fixed_cumulative.data()),
+                   n_fields * sizeof(unsigned int));
+        file.write(reinterpret_cast<const char *>(field_offsets.data()),
+                   n_fields * sizeof(std::uint64_t));
+
+        // Write packed data field by field.
+        for (unsigned int f = 0; f < n_fields; ++f)
+          {
+            const std::vector<char> buffer = extract_field(f);
+            file.write(buffer.data(), buffer.size());
+          }
+      }
 
-            std::uint64_t prefix_sum = 0;
-            ierr                     = MPI_Exscan(&size_on_proc,
-                              &prefix_sum,
-                              1,
-                              MPI_UINT64_T,
-                              MPI_SUM,
+    if (variable_size_data_stored)
+      save_variable_size_data(global_first_cell,
+                              global_num_cells,
+                              file_basename,
                               mpi_communicator);
-            AssertThrowMPI(ierr);
+  }
 
-            const MPI_Offset my_global_file_position =
-              static_cast<MPI_Offset>(global_num_cells) * sizeof(unsigned int) +
-              prefix_sum;
 
-            dest_data_variable.resize(size_on_proc);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+  template <int dim, int spacedim>
+  DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+  void CellAttachedDataSerializer<dim, spacedim>::load_indexed(
+    const unsigned int               global_first_cell,
+    const unsigned int               global_num_cells,
+    const unsigned int               local_num_cells,
+    const std::string               &file_basename,
+    const std::vector<unsigned int> &fixed_size_attachments,
+    const unsigned int               n_attached_deserialize_variable,
+    const MPI_Comm                  &mpi_communicator)
+  {
+    Assert(dest_data_fixed.empty(),
+           ExcMessage("Previously loaded data has not been released yet!"));
+
+    variable_size_data_stored = (n_attached_deserialize_variable > 0);
+
+    const std::string fname_fixed = std::string(file_basename) + "_fixed.data";
+
+    // Read the header. Since all processors need the same information about
+    // the data layout, let each of them retrieve it by reading from the same
+    // location in the file.
+    unsigned int               n_fields = 0;
+    std::vector<unsigned int>  sizes_fixed_cumulative_saved;
+    std::vector<std::uint64_t> field_offsets;
+
+    const auto saved_field_size = [&](const unsigned int f) {
+      return sizes_fixed_cumulative_saved[f] -
+             (f == 0 ? 0 : sizes_fixed_cumulative_saved[f - 1]);
+    };
+
+    // Then determine the fields to be read: the CellStatus information is
+    // always needed, followed by the requested fixed size attachments and,
+    // if variable size data is to be loaded, the data sizes of the variable
+    // size attachments which were stored last.
+    std::vector<unsigned int> fields_to_load;
+    const auto                setup_fields = [&]() {
+      AssertThrow(n_fields >= 1 + (variable_size_data_stored ? 1 : 0),
+                  ExcMessage("The file <" + fname_fixed +
+                             "> does not contain the expected fields."));
+      const unsigned int n_fixed_size_attachments_saved =
+        n_fields - 1 - (variable_size_data_stored ? 1 : 0);
+
+      fields_to_load.clear();
+      fields_to_load.push_back(0);
+      for (const unsigned int i : fixed_size_attachments)
+        {
+          AssertIndexRange(i, n_fixed_size_attachments_saved);
+          fields_to_load.push_back(1 + i);
+        }
+      if (variable_size_data_stored)
+        fields_to_load.push_back(n_fields - 1);
+
+      // The loaded data will be arranged as if only the selected fields had
+      // been packed.
+      sizes_fixed_cumulative.resize(fields_to_load.size());
+      for (unsigned int k = 0; k < fields_to_load.size(); ++k)
+        {
+          const unsigned int f = fields_to_load[k];
+          sizes_fixed_cumulative[k] =
+            (k == 0 ? 0 : sizes_fixed_cumulative[k - 1]) + saved_field_size(f);
+        }
+
+      dest_data_fixed.resize(static_cast<std::size_t>(local_num_cells) *
+                             sizes_fixed_cumulative.back());
+    };
+
+    // Copy the data of one field from a contiguous buffer into its position
+    // within the data of each cell.
+    const auto insert_field = [&](const unsigned int       k,
+                                  const std::vector<char> &buffer) {
+      const unsigned int field_begin =
+        (k == 0) ? 0 : sizes_fixed_cumulative[k - 1];
+      const unsigned int field_size     = sizes_fixed_cumulative[k] - field_begin;
+      const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
+
+      for (std::size_t c = 0; c < local_num_cells; ++c)
+        std::memcpy(dest_data_fixed.data() + c * bytes_per_cell + field_begin,
+                    buffer.data() + c * field_size,
+                    field_size);
+    };
+
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int mpisize =
+      Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    if (mpisize > 1)
+      {
+        MPI_Info info;
+        int      ierr = MPI_Info_create(&info);
+        AssertThrowMPI(ierr);
+
+        MPI_File fh;
+        ierr = MPI_File_open(
+          mpi_communicator, fname_fixed.c_str(), MPI_MODE_RDONLY, info, &fh);
+        AssertThrowMPI(ierr);
+
+        ierr = MPI_Info_free(&info);
+        AssertThrowMPI(ierr);
+
+        ierr =
+          MPI_File_read_at(fh, 0, &n_fields, 1, MPI_UNSIGNED, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        sizes_fixed_cumulative_saved.resize(n_fields);
+        ierr = Utilities::MPI::LargeCount::File_read_at_c(
+          fh,
+          sizeof(unsigned int),
+          sizes_fixed_cumulative_saved.data(),
+          n_fields,
+          MPI_UNSIGNED,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        field_offsets.resize(n_fields);
+        ierr = Utilities::MPI::LargeCount::File_read_at_c(
+          fh,
+          (1 + n_fields) * sizeof(unsigned int),
+          field_offsets.data(),
+          n_fields,
+          MPI_UINT64_T,
+          MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        setup_fields();
+
+        // Read our range of cells of each selected field with a single
+        // contiguous, collective call. Fields that have not been selected
+        // are not touched at all.
+        for (unsigned int k = 0; k < fields_to_load.size(); ++k)
+          {
+            const unsigned int f          = fields_to_load[k];
+            const unsigned int field_size = saved_field_size(f);
+
+            std::vector<char> buffer(static_cast<std::size_t>(local_num_cells) *
+                                     field_size);
+
+            const MPI_Offset my_global_file_position =
+              field_offsets[f] +
+              static_cast<MPI_Offset>(global_first_cell) * field_size;
+
+            ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
               fh,
               my_global_file_position,
-              dest_data_variable.data(),
-              dest_data_variable.size(),
+              buffer.data(),
+              buffer.size(),
               MPI_BYTE,
               MPI_STATUS_IGNORE);
             AssertThrowMPI(ierr);
 
-            ierr = MPI_File_close(&fh);
-            AssertThrowMPI(ierr);
+            insert_field(k, buffer);
           }
+
+        ierr = MPI_File_close(&fh);
+        AssertThrowMPI(ierr);
       }
     else // if (mpisize > 1)
 #endif
       {
         (void)global_first_cell;
-        (void)global_num_cells;
         (void)mpi_communicator;
 
-        //
-        // ---------- Fixed size data ----------
-        //
-        {
-          const std::string fname_fixed =
-            std::string(file_basename) + "_fixed.data";
+        std::ifstream file(fname_fixed, std::ios::binary | std::ios::in);
+        AssertThrow(file.fail() == false, ExcIO());
 
-          std::ifstream file(fname_fixed, std::ios::binary | std::ios::in);
-          AssertThrow(file.fail() == false, ExcIO());
-
-          sizes_fixed_cumulative.resize(1 + n_attached_deserialize_fixed +
-                                        (variable_size_data_stored ? 1 : 0));
+        // Read header data.
+        file.read(reinterpret_cast<char *>(&n_fields), sizeof(unsigned int));
 
-          // Read header data.
-          file.read(reinterpret_cast<char *>(sizes_fixed_cumulative.data()),
-                    sizes_fixed_cumulative.size() * sizeof(unsigned int));
+        sizes_fixed_cumulative_saved.resize(n_fields);
+        file.read(reinterpret_cast<char *>(sizes_fixed_cumulative_saved.data()),
+                  n_fields * sizeof(unsigned int));
 
-          const unsigned int bytes_per_cell = sizes_fixed_cumulative.back();
-          dest_data_fixed.resize(static_cast<size_t>(local_num_cells) *
-                                 bytes_per_cell);
+        field_offsets.resize(n_fields);
+        file.read(reinterpret_cast<char *>(field_offsets.data()),
+                  n_fields * sizeof(std::uint64_t));
 
-          // Read packed data.
-          file.read(reinterpret_cast<char *>(dest_data_fixed.data()),
-                    dest_data_fixed.size() * sizeof(char));
-        }
+        setup_fields();
 
-        //
-        // ---------- Variable size data ----------
-        //
-        if (variable_size_data_stored)
+        // Read the selected fields.
+        for (unsigned int k = 0; k < fields_to_load.size(); ++k)
           {
-            const std::string fname_variable =
-              std::string(file_basename) + "_variable.data";
-
-            std::ifstream file(fname_variable, std::ios::binary | std::ios::in);
-            AssertThrow(file.fail() == false, ExcIO());
-
-            // Read header data.
-            dest_sizes_variable.resize(local_num_cells);
-            file.read(reinterpret_cast<char *>(dest_sizes_variable.data()),
-                      dest_sizes_variable.size() * sizeof(int));
-
-            // Read packed data.
-            const std::uint64_t size =
-              std::accumulate(dest_sizes_variable.begin(),
-                              dest_sizes_variable.end(),
-                              0ULL);
-            dest_data_variable.resize(size);
-            file.read(reinterpret_cast<char *>(dest_data_variable.data()),
-                      dest_data_variable.size() * sizeof(char));
+            const unsigned int f          = fields_to_load[k];
+            const unsigned int field_size = saved_field_size(f);
+
+            std::vector<char> buffer(static_cast<std::size_t>(local_num_cells) *
+                                     field_size);
+
+            file.seekg(field_offsets[f]);
+            file.read(buffer.data(), buffer.size());
+
+            insert_field(k, buffer);
           }
       }
+
+    if (variable_size_data_stored)
+      load_variable_size_data(global_first_cell,
+                              global_num_cells,
+                              local_num_cells,
+                              file_basename,
+                              mpi_communicator);
   }
 
 
+
   template <int dim, int spacedim>
   DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
   void CellAttachedDataSerializer<dim, spacedim>::clear()
@@ -2330,8 +2742,12 @@ namespace internal
               tria_objects.boundary_or_material_id.reserve(new_size);
               tria_objects.boundary_or_material_id.resize(new_size);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // user data is only allocated once it has been written to
+              if (tria_objects.user_data.has_value())
+                {
+                  tria_objects.user_data.value().reserve(new_size);
+                  tria_objects.user_data.value().resize(new_size);
+                }
 
               tria_objects.manifold_id.reserve(new_size);
               tria_objects.manifold_id.insert(tria_objects.manifold_id.end(),
@@ -2397,8 +2813,12 @@ namespace internal
                                                 tria_objects.manifold_id.size(),
                                               numbers::flat_manifold_id);
 
-              tria_objects.user_data.reserve(new_size);
-              tria_objects.user_data.resize(new_size);
+              // user data is only allocated once it has been written to
+              if (tria_objects.user_data.has_value())
+                {
+                  tria_objects.user_data.value().reserve(new_size);
+                  tria_objects.user_data.value().resize(new_size);
+                }
 
               tria_objects.refinement_cases.reserve(new_size);
               tria_objects.refinement_cases.insert(
@@ -2433,9 +2853,10 @@ namespace internal
       Assert(tria_object.n_objects() == tria_object.manifold_id.size(),
              ExcMemoryInexact(tria_object.n_objects(),
                               tria_object.manifold_id.size()));
-      Assert(tria_object.n_objects() == tria_object.user_data.size(),
+      Assert(tria_object.user_data.has_value() == false ||
+               tria_object.n_objects() == tria_object.user_data.value().size(),
              ExcMemoryInexact(tria_object.n_objects(),
-                              tria_object.user_data.size()));
+                              tria_object.user_data.value().size()));
 
       if (tria_object.structdim == 1)
         {
@@ -3642,7 +4063,7 @@ namespace internal
             BoundaryOrMaterialId());
         obj.manifold_id.assign(size, -1);
         obj.user_flags.assign(size, false);
-        obj.user_data.resize(size);
+        obj.user_data.reset();
 
         if (structdim > 1) // TODO: why?
           obj.refinement_cases.assign(size, 0);
@@ -4916,6 +5337,39 @@ namespace internal
 
 
 
+      /**
+       * Compute the positions of the new vertices at the centers of the
+       * given lines, quads, or cells, in the order of the given objects.
+       * The positions only depend on the geometry of the objects and the
+       * manifolds attached to them, not on the data structures that are
+       * modified while creating the children, so we can compute them in
+       * parallel before the (sequential) creation of the children. This is
+       * where most of the time of the refinement goes for meshes with
+       * curved manifolds.
+       *
+       * If @p use_interpolation is true, the new vertices of objects of
+       * lower dimension need to be set already, see
+       * TriaAccessor::center().
+       */
+      template <int spacedim, typename IteratorType>
+      static std::vector<Point<spacedim>>
+      compute_new_center_vertices(const std::vector<IteratorType> &objects,
+                                  const bool use_interpolation)
+      {
+        std::vector<Point<spacedim>> centers(objects.size());
+        dealii::parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(objects.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              centers[i] = objects[i]->center(true, use_interpolation);
+          },
+          /* grainsize = */ 128);
+        return centers;
+      }
+
+
+
       template <int dim, int spacedim>
       static typename Triangulation<dim, spacedim>::DistortedCellList
       execute_refinement_isotropic(Triangulation<dim, spacedim> &triangulation,
@@ -5032,6 +5486,16 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          // Compute the new vertices on the lines to be refined up front
+          std::vector<typename Triangulation<dim, spacedim>::line_iterator>
+            lines_to_refine;
+          for (auto l = line; l != endl; ++l)
+            if (l->user_flag_set())
+              lines_to_refine.push_back(l);
+          const std::vector<Point<spacedim>> line_centers =
+            compute_new_center_vertices<spacedim>(lines_to_refine, false);
+          unsigned int n_refined_lines = 0;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5047,7 +5511,8 @@ namespace internal
                          "enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                triangulation.vertices[next_unused_vertex] =
+                  line_centers[n_refined_lines++];
 
                 bool pair_found = false;
                 (void)pair_found;
@@ -5088,6 +5553,7 @@ namespace internal
 
                 line->clear_user_flag();
               }
+          AssertDimension(n_refined_lines, line_centers.size());
         }
 
         reserve_space(triangulation.faces->lines, 0, n_single_lines);
@@ -5098,11 +5564,23 @@ namespace internal
         typename Triangulation<dim, spacedim>::raw_line_iterator
           next_unused_line = triangulation.begin_raw_line();
 
-        const auto create_children = [](auto         &triangulation,
-                                        unsigned int &next_unused_vertex,
-                                        auto         &next_unused_line,
-                                        auto         &next_unused_cell,
-                                        const auto   &cell) {
+        // The new vertices in the centers of quadrilaterals are interpolated
+        // from the vertices on their lines, which are all set by now
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          quads_to_refine;
+        for (const auto &cell : triangulation.active_cell_iterators())
+          if (cell->refine_flag_set() &&
+              cell->reference_cell() == ReferenceCells::Quadrilateral)
+            quads_to_refine.push_back(cell);
+        const std::vector<Point<spacedim>> cell_centers =
+          compute_new_center_vertices<spacedim>(quads_to_refine, true);
+        unsigned int n_refined_quads = 0;
+
+        const auto create_children = [&](auto         &triangulation,
+                                         unsigned int &next_unused_vertex,
+                                         auto         &next_unused_line,
+                                         auto         &next_unused_cell,
+                                         const auto   &cell) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
 
@@ -5140,7 +5618,7 @@ namespace internal
               new_vertices[8] = next_unused_vertex;
 
               triangulation.vertices[next_unused_vertex] =
-                cell->center(true, true);
+                cell_centers[n_refined_quads++];
             }
 
           std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
@@ -5365,6 +5843,7 @@ namespace internal
                   triangulation.signals.post_refinement_on_cell(cell);
                 }
           }
+        AssertDimension(n_refined_quads, cell_centers.size());
 
         return cells_with_distorted_children;
       }
@@ -6154,6 +6633,16 @@ namespace internal
             endl = triangulation.end_line();
           raw_line_iterator next_unused_line = triangulation.begin_raw_line();
 
+          // Compute the new vertices on the lines to be refined up front
+          std::vector<typename Triangulation<dim, spacedim>::line_iterator>
+            lines_to_refine;
+          for (auto l = line; l != endl; ++l)
+            if (l->user_flag_set())
+              lines_to_refine.push_back(l);
+          const std::vector<Point<spacedim>> line_centers =
+            compute_new_center_vertices<spacedim>(lines_to_refine, false);
+          unsigned int n_refined_lines = 0;
+
           for (; line != endl; ++line)
             {
               if (line->user_flag_set() == false)
@@ -6179,7 +6668,8 @@ namespace internal
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              triangulation.vertices[current_vertex] =
+                line_centers[n_refined_lines++];
 
               children[0]->set_bounding_object_indices(
                 {line->vertex_index(0), current_vertex});
@@ -6200,6 +6690,7 @@ namespace internal
 
               line->clear_user_flag();
             }
+          AssertDimension(n_refined_lines, line_centers.size());
         }
 
         // QUADS
@@ -6208,6 +6699,19 @@ namespace internal
             quad = triangulation.begin_quad(),
             endq = triangulation.end_quad();
 
+          // The new vertices in the centers of quadrilaterals are
+          // interpolated from the vertices on their lines, which are all set
+          // by now
+          std::vector<typename Triangulation<dim, spacedim>::quad_iterator>
+            quads_to_refine;
+          for (auto q = quad; q != endq; ++q)
+            if (q->user_flag_set() &&
+                q->reference_cell() == ReferenceCells::Quadrilateral)
+              quads_to_refine.push_back(q);
+          const std::vector<Point<spacedim>> quad_centers =
+            compute_new_center_vertices<spacedim>(quads_to_refine, true);
+          unsigned int n_refined_quads = 0;
+
           for (; quad != endq; ++quad)
             {
               if (quad->user_flag_set() == false)
@@ -6289,7 +6793,7 @@ namespace internal
                   vertex_indices[k++] = current_vertex;
 
                   triangulation.vertices[current_vertex] =
-                    quad->center(true, true);
+                    quad_centers[n_refined_quads++];
                 }
 
               // 4) set new lines on quads and their properties
@@ -6477,11 +6981,24 @@ namespace internal
 
               quad->clear_user_flag();
             }
+          AssertDimension(n_refined_quads, quad_centers.size());
         }
 
         typename Triangulation<3, spacedim>::DistortedCellList
           cells_with_distorted_children;
 
+        // The new vertices in the centers of hexahedra are interpolated from
+        // the vertices on their lines and faces, which are all set by now
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          hexes_to_refine;
+        for (const auto &cell : triangulation.active_cell_iterators())
+          if (cell->refine_flag_set() &&
+              cell->reference_cell() == ReferenceCells::Hexahedron)
+            hexes_to_refine.push_back(cell);
+        const std::vector<Point<spacedim>> hex_centers =
+          compute_new_center_vertices<spacedim>(hexes_to_refine, true);
+        unsigned int n_refined_hexes = 0;
+
         typename Triangulation<dim, spacedim>::active_hex_iterator hex =
           triangulation.begin_active_hex(0);
         for (unsigned int level = 0; level != triangulation.levels.size() - 1;
@@ -6667,7 +7184,7 @@ namespace internal
                         vertex_indices[k++] = current_vertex;
 
                         triangulation.vertices[current_vertex] =
-                          hex->center(true, true);
+                          hex_centers[n_refined_hexes++];
                       }
                   }
 
@@ -7103,6 +7620,7 @@ namespace internal
                 triangulation.signals.post_refinement_on_cell(hex);
               }
           }
+        AssertDimension(n_refined_hexes, hex_centers.size());
 
         triangulation.faces->quads.clear_user_data();
 
@@ -16067,7 +16585,8 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::save_attached_data(
   const unsigned int global_first_cell,
   const unsigned int global_num_cells,
-  const std::string &file_basename) const
+  const std::string &file_basename,
+  const bool         indexed_layout) const
 {
   // cast away constness
   auto tria = const_cast<Triangulation<dim, spacedim> *>(this);
@@ -16082,10 +16601,16 @@ void Triangulation<dim, spacedim>::save_attached_data(
         this->get_communicator());
 
       // then store buffers in file
-      tria->data_serializer.save(global_first_cell,
-                                 global_num_cells,
-                                 file_basename,
-                                 this->get_communicator());
+      if (indexed_layout)
+        tria->data_serializer.save_indexed(global_first_cell,
+                                           global_num_cells,
+                                           file_basename,
+                                           this->get_communicator());
+      else
+        tria->data_serializer.save(global_first_cell,
+                                   global_num_cells,
+                                   file_basename,
+                                   this->get_communicator());
 
       // and release the memory afterwards
       tria->data_serializer.clear();
@@ -16137,6 +16662,42 @@ void Triangulation<dim, spacedim>::load_attached_data(
 }
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void Triangulation<dim, spacedim>::load_attached_data(
+  const unsigned int               global_first_cell,
+  const unsigned int               global_num_cells,
+  const unsigned int               local_num_cells,
+  const std::string               &file_basename,
+  const std::vector<unsigned int> &fixed_size_attachments,
+  const unsigned int               n_attached_deserialize_variable)
+{
+  // load saved data, if any was stored
+  if (this->cell_attached_data.n_attached_deserialize > 0)
+    {
+      this->data_serializer.load_indexed(global_first_cell,
+                                         global_num_cells,
+                                         local_num_cells,
+                                         file_basename,
+                                         fixed_size_attachments,
+                                         n_attached_deserialize_variable,
+                                         this->get_communicator());
+
+      this->data_serializer.unpack_cell_status(this->local_cell_relations);
+
+      // the CellStatus of all stored cells should always be
+      // CellStatus::cell_will_persist.
+      for (const auto &cell_rel : this->local_cell_relations)
+        {
+          (void)cell_rel;
+          Assert((cell_rel.second == // cell_status
+                  ::dealii::CellStatus::cell_will_persist),
+                 ExcInternalError());
+        }
+    }
+}
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void Triangulation<dim, spacedim>::clear_despite_subscriptions()
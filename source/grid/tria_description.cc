@@ -27,6 +27,9 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <cstdint>
+#include <fstream>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -397,23 +400,122 @@ namespace TriangulationDescription
       };
 
       /**
-       * Set the user_flag of a cell and of all its parent cells.
+       * The cells of a triangulation grouped by the (level) subdomain id
+       * returned by the functions passed to create_description_for_rank(),
+       * together with the cells adjacent to each vertex on each level. This
+       * information is collected in a single pass over the triangulation, so
+       * that creating the descriptions for many ranks only needs to look at
+       * the cells owned by each rank and their neighbors, rather than at all
+       * cells of the triangulation for each rank.
+       */
+      template <int dim, int spacedim>
+      struct CellsByOwner
+      {
+        using cell_iterator =
+          typename dealii::Triangulation<dim, spacedim>::cell_iterator;
+
+        /**
+         * The active cells by subdomain id.
+         */
+        std::map<types::subdomain_id, std::vector<cell_iterator>>
+          active_cells;
+
+        /**
+         * For each level, the cells by level subdomain id. Only filled if the
+         * multigrid hierarchy is requested.
+         */
+        std::vector<std::map<types::subdomain_id, std::vector<cell_iterator>>>
+          level_cells;
+
+        /**
+         * For each level, the indices of the cells adjacent to each vertex,
+         * in compressed row storage: The cells adjacent to vertex `v` on
+         * level `l` are
+         * `vertex_to_cells[l][vertex_to_cells_offsets[l][v]]` up to
+         * `vertex_to_cells[l][vertex_to_cells_offsets[l][v + 1]]`.
+         */
+        std::vector<std::vector<unsigned int>> vertex_to_cells_offsets;
+        std::vector<std::vector<unsigned int>> vertex_to_cells;
+
+        /**
+         * Return the cells of @p cells owned by @p rank, or an empty vector.
+         */
+        static const std::vector<cell_iterator> &
+        cells_of_rank(
+          const std::map<types::subdomain_id, std::vector<cell_iterator>>
+                                   &cells,
+          const types::subdomain_id rank)
+        {
+          static const std::vector<cell_iterator> no_cells;
+          const auto                              it = cells.find(rank);
+          return it == cells.end() ? no_cells : it->second;
+        }
+      };
+
+
+
+      /**
+       * Set up a CellsByOwner object for the given triangulation.
        */
       template <int dim, int spacedim>
-      void
-      mark_cell_and_its_parents(
-        const TriaIterator<CellAccessor<dim, spacedim>> &cell,
-        std::vector<std::vector<bool>>                  &cell_marked)
+      CellsByOwner<dim, spacedim>
+      collect_cells_by_owner(
+        const dealii::Triangulation<dim, spacedim> &tria,
+        const std::function<types::subdomain_id(
+          const typename dealii::Triangulation<dim, spacedim>::cell_iterator &)>
+          &subdomain_id_function,
+        const std::function<types::subdomain_id(
+          const typename dealii::Triangulation<dim, spacedim>::cell_iterator &)>
+                  &level_subdomain_id_function,
+        const bool construct_multigrid)
       {
-        cell_marked[cell->level()][cell->index()] = true;
-        if (cell->level() != 0)
-          mark_cell_and_its_parents(cell->parent(), cell_marked);
+        CellsByOwner<dim, spacedim> cells;
+
+        for (const auto &cell : tria.active_cell_iterators())
+          cells.active_cells[subdomain_id_function(cell)].push_back(cell);
+
+        if (construct_multigrid)
+          {
+            cells.level_cells.resize(tria.n_levels());
+            for (unsigned int l = 0; l < tria.n_levels(); ++l)
+              for (const auto &cell : tria.cell_iterators_on_level(l))
+                cells.level_cells[l][level_subdomain_id_function(cell)]
+                  .push_back(cell);
+          }
+
+        cells.vertex_to_cells_offsets.resize(tria.n_levels());
+        cells.vertex_to_cells.resize(tria.n_levels());
+        for (unsigned int l = 0; l < tria.n_levels(); ++l)
+          {
+            std::vector<unsigned int> &offsets =
+              cells.vertex_to_cells_offsets[l];
+            offsets.assign(tria.n_vertices() + 1, 0);
+            for (const auto &cell : tria.cell_iterators_on_level(l))
+              for (const auto v : cell->vertex_indices())
+                ++offsets[cell->vertex_index(v) + 1];
+            for (unsigned int v = 0; v < tria.n_vertices(); ++v)
+              offsets[v + 1] += offsets[v];
+
+            std::vector<unsigned int> position(offsets.begin(),
+                                               offsets.end() - 1);
+            cells.vertex_to_cells[l].resize(offsets.back());
+            for (const auto &cell : tria.cell_iterators_on_level(l))
+              for (const auto v : cell->vertex_indices())
+                cells.vertex_to_cells[l][position[cell->vertex_index(v)]++] =
+                  cell->index();
+          }
+
+        return cells;
       }
 
+
+
       /**
        * A helper function for the
        * TriangulationDescription::Utilities::create_description_from_triangulation()
-       * function.
+       * function. The cost of this function is proportional to the number
+       * of cells that are locally relevant for @p my_rank, given the
+       * information in @p cells_by_owner.
        */
       template <typename DescriptionType, int dim, int spacedim>
       DescriptionType
@@ -428,9 +530,10 @@ namespace TriangulationDescription
         const std::map<unsigned int, std::vector<unsigned int>>
           &coinciding_vertex_groups,
         const std::map<unsigned int, unsigned int>
-                          &vertex_to_coinciding_vertex_group,
-        const MPI_Comm     comm,
-        const unsigned int my_rank,
+                                          &vertex_to_coinciding_vertex_group,
+        const CellsByOwner<dim, spacedim> &cells_by_owner,
+        const MPI_Comm                     comm,
+        const unsigned int                 my_rank,
         const TriangulationDescription::Settings settings)
       {
         static_assert(
@@ -447,9 +550,15 @@ namespace TriangulationDescription
             "limit_level_difference_at_vertices if the construction of the "
             "multigrid hierarchy is requested!"));
 
+        using cell_iterator =
+          typename dealii::Triangulation<dim, spacedim>::cell_iterator;
+
         const bool construct_multigrid =
           ((settings & TriangulationDescription::Settings::
                          construct_multigrid_hierarchy) != 0u);
+        Assert(construct_multigrid == false ||
+                 cells_by_owner.level_cells.size() == tria.n_levels(),
+               ExcInternalError());
 
         DescriptionType construction_data;
         if constexpr (std::is_same_v<DescriptionType,
@@ -462,118 +571,103 @@ namespace TriangulationDescription
         else
           (void)comm;
 
-        // A helper function that marks the indices of all vertices belonging
-        // to a cell (also taking into account their periodic breathren) in
-        // the bit vector passed as second argument.
-        const auto
-          add_vertices_of_cell_to_vertices_owned_by_locally_owned_cells =
-            [&coinciding_vertex_groups, &vertex_to_coinciding_vertex_group](
-              const typename dealii::Triangulation<dim, spacedim>::cell_iterator
-                                &cell,
-              std::vector<bool> &vertices_on_locally_owned_cells) {
-              for (const unsigned int v : cell->vertex_indices())
-                {
-                  const auto global_vertex_index = cell->vertex_index(v);
-                  vertices_on_locally_owned_cells[global_vertex_index] = true;
-
-                  const auto coinciding_vertex_group =
-                    vertex_to_coinciding_vertex_group.find(global_vertex_index);
-                  if (coinciding_vertex_group !=
-                      vertex_to_coinciding_vertex_group.end())
-                    for (const auto &co_vertex : coinciding_vertex_groups.at(
-                           coinciding_vertex_group->second))
-                      vertices_on_locally_owned_cells[co_vertex] = true;
-                }
-            };
-
-        const auto add_vertices =
-          [&tria](const std::vector<bool> &vertices_locally_relevant,
-                  DescriptionType         &construction_data) {
-            if constexpr (std::is_same_v<DescriptionType,
-                                         Description<dim, spacedim>>)
+        // A helper function that adds the indices of all vertices belonging
+        // to a cell (also taking into account their periodic breathren) to
+        // the vector passed as second argument. The vector is sorted and
+        // made unique by finalize_vertices() below.
+        const auto add_vertices_of_cell =
+          [&coinciding_vertex_groups, &vertex_to_coinciding_vertex_group](
+            const cell_iterator &cell, std::vector<unsigned int> &vertices) {
+            for (const unsigned int v : cell->vertex_indices())
               {
-                std::vector<unsigned int> vertices_locally_relevant_indices(
-                  vertices_locally_relevant.size());
-
-                // enumerate locally relevant vertices
-                unsigned int vertex_counter = 0;
-                for (unsigned int i = 0; i < vertices_locally_relevant.size();
-                     ++i)
-                  if (vertices_locally_relevant[i])
-                    {
-                      construction_data.coarse_cell_vertices.push_back(
-                        tria.get_vertices()[i]);
-                      vertices_locally_relevant_indices[i] = vertex_counter++;
-                    }
-
-                // correct vertices of cells (make them local)
-                for (auto &cell : construction_data.coarse_cells)
-                  for (unsigned int v = 0; v < cell.vertices.size(); ++v)
-                    cell.vertices[v] =
-                      vertices_locally_relevant_indices[cell.vertices[v]];
-              }
-            else
-              {
-                for (unsigned int i = 0; i < vertices_locally_relevant.size();
-                     ++i)
-                  if (vertices_locally_relevant[i])
-                    construction_data.coarse_cell_vertices.emplace_back(
-                      i, tria.get_vertices()[i]);
+                const auto global_vertex_index = cell->vertex_index(v);
+                vertices.push_back(global_vertex_index);
+
+                const auto coinciding_vertex_group =
+                  vertex_to_coinciding_vertex_group.find(global_vertex_index);
+                if (coinciding_vertex_group !=
+                    vertex_to_coinciding_vertex_group.end())
+                  for (const auto &co_vertex : coinciding_vertex_groups.at(
+                         coinciding_vertex_group->second))
+                    vertices.push_back(co_vertex);
               }
           };
 
+        const auto finalize_vertices = [](std::vector<unsigned int> &vertices) {
+          std::sort(vertices.begin(), vertices.end());
+          vertices.erase(std::unique(vertices.begin(), vertices.end()),
+                         vertices.end());
+        };
 
-        // 1) loop over levels (from fine to coarse) and mark on each level
-        //    the locally relevant cells
-        std::vector<std::vector<bool>> cell_marked(tria.n_levels());
-        for (unsigned int l = 0; l < tria.n_levels(); ++l)
-          cell_marked[l].resize(tria.n_raw_cells(l));
+        const auto contains = [](const std::vector<unsigned int> &vertices,
+                                 const unsigned int               vertex) {
+          return std::binary_search(vertices.begin(), vertices.end(), vertex);
+        };
 
-        for (int level = tria.get_triangulation().n_global_levels() - 1;
-             level >= 0;
-             --level)
-          {
-            // collect vertices connected to a (on any level) locally owned
-            // cell
-            std::vector<bool> vertices_owned_by_locally_owned_cells_on_level(
-              tria.n_vertices());
-            for (const auto &cell : tria.cell_iterators_on_level(level))
-              if (construct_multigrid &&
-                  (level_subdomain_id_function(cell) == my_rank))
-                add_vertices_of_cell_to_vertices_owned_by_locally_owned_cells(
-                  cell, vertices_owned_by_locally_owned_cells_on_level);
-
-            for (const auto &cell : tria.active_cell_iterators())
-              if (subdomain_id_function(cell) == my_rank)
-                add_vertices_of_cell_to_vertices_owned_by_locally_owned_cells(
-                  cell, vertices_owned_by_locally_owned_cells_on_level);
+        const std::vector<cell_iterator> &locally_owned_active_cells =
+          CellsByOwner<dim, spacedim>::cells_of_rank(
+            cells_by_owner.active_cells, my_rank);
 
-            // helper function to determine if cell is locally relevant
-            // (i.e. a cell which is connected to a vertex via a locally
-            // owned cell)
-            const auto is_locally_relevant_on_level = [&](const auto &cell) {
-              for (const auto v : cell->vertex_indices())
-                if (vertices_owned_by_locally_owned_cells_on_level
-                      [cell->vertex_index(v)])
-                  return true;
-              return false;
-            };
+        // collect the vertices of the locally owned active cells
+        std::vector<unsigned int> vertices_owned_by_locally_owned_active_cells;
+        for (const auto &cell : locally_owned_active_cells)
+          add_vertices_of_cell(cell,
+                               vertices_owned_by_locally_owned_active_cells);
+        finalize_vertices(vertices_owned_by_locally_owned_active_cells);
 
-            // mark all locally relevant cells
-            for (const auto &cell : tria.cell_iterators_on_level(level))
-              if (is_locally_relevant_on_level(cell))
-                mark_cell_and_its_parents(cell, cell_marked);
+        // 1) loop over levels (from fine to coarse) and mark on each level
+        //    the locally relevant cells, i.e., the cells connected to a
+        //    vertex of a (on any level) locally owned cell, together with
+        //    their parents. The marked cells are stored as pairs of level
+        //    and index, and sorted by level and index afterwards.
+        std::vector<std::pair<unsigned int, unsigned int>> marked_cells;
+        for (int level = tria.n_levels() - 1; level >= 0; --level)
+          {
+            std::vector<unsigned int> vertices_on_level =
+              vertices_owned_by_locally_owned_active_cells;
+            if (construct_multigrid)
+              {
+                for (const auto &cell :
+                     CellsByOwner<dim, spacedim>::cells_of_rank(
+                       cells_by_owner.level_cells[level], my_rank))
+                  add_vertices_of_cell(cell, vertices_on_level);
+                finalize_vertices(vertices_on_level);
+              }
+
+            const std::vector<unsigned int> &offsets =
+              cells_by_owner.vertex_to_cells_offsets[level];
+            for (const unsigned int vertex : vertices_on_level)
+              for (unsigned int i = offsets[vertex]; i < offsets[vertex + 1];
+                   ++i)
+                {
+                  // mark the cell and all its parents
+                  cell_iterator cell(&tria,
+                                     level,
+                                     cells_by_owner.vertex_to_cells[level][i]);
+                  marked_cells.emplace_back(level, cell->index());
+                  while (cell->level() > 0)
+                    {
+                      cell = cell->parent();
+                      marked_cells.emplace_back(cell->level(), cell->index());
+                    }
+                }
           }
+        std::sort(marked_cells.begin(), marked_cells.end());
+        marked_cells.erase(std::unique(marked_cells.begin(),
+                                       marked_cells.end()),
+                           marked_cells.end());
 
         // 2) set_up coarse-grid triangulation
         {
-          std::vector<bool> vertices_locally_relevant(tria.n_vertices(), false);
+          std::vector<unsigned int> vertices_locally_relevant;
 
-          // a) loop over all cells
-          for (const auto &cell : tria.cell_iterators_on_level(0))
+          // a) loop over all marked cells on the coarse level
+          for (const auto &[level, index] : marked_cells)
             {
-              if (!cell_marked[cell->level()][cell->index()])
-                continue;
+              if (level > 0)
+                break;
+
+              const cell_iterator cell(&tria, level, index);
 
               // extract cell definition (with old numbering of vertices)
               dealii::CellData<dim> cell_data(cell->n_vertices());
@@ -585,14 +679,39 @@ namespace TriangulationDescription
 
               // save indices of each vertex of this cell
               for (const auto v : cell->vertex_indices())
-                vertices_locally_relevant[cell->vertex_index(v)] = true;
+                vertices_locally_relevant.push_back(cell->vertex_index(v));
 
               // save translation for corase grid: lid -> gid
               construction_data.coarse_cell_index_to_coarse_cell_id.push_back(
                 cell->id().get_coarse_cell_id());
             }
+          finalize_vertices(vertices_locally_relevant);
 
-          add_vertices(vertices_locally_relevant, construction_data);
+          // b) add the vertices
+          if constexpr (std::is_same_v<DescriptionType,
+                                       Description<dim, spacedim>>)
+            {
+              // enumerate locally relevant vertices in the order of their
+              // global indices
+              for (const unsigned int i : vertices_locally_relevant)
+                construction_data.coarse_cell_vertices.push_back(
+                  tria.get_vertices()[i]);
+
+              // correct vertices of cells (make them local)
+              for (auto &cell : construction_data.coarse_cells)
+                for (unsigned int v = 0; v < cell.vertices.size(); ++v)
+                  cell.vertices[v] =
+                    std::lower_bound(vertices_locally_relevant.begin(),
+                                     vertices_locally_relevant.end(),
+                                     cell.vertices[v]) -
+                    vertices_locally_relevant.begin();
+            }
+          else
+            {
+              for (const unsigned int i : vertices_locally_relevant)
+                construction_data.coarse_cell_vertices.emplace_back(
+                  i, tria.get_vertices()[i]);
+            }
         }
 
 
@@ -600,55 +719,52 @@ namespace TriangulationDescription
         construction_data.cell_infos.resize(
           tria.get_triangulation().n_global_levels());
 
-        // collect local vertices on active level
-        std::vector<bool> vertices_owned_by_locally_owned_active_cells(
-          tria.n_vertices());
-        for (const auto &cell : tria.active_cell_iterators())
-          if (subdomain_id_function(cell) == my_rank)
-            add_vertices_of_cell_to_vertices_owned_by_locally_owned_cells(
-              cell, vertices_owned_by_locally_owned_active_cells);
-
         // helper function to determine if cell is locally relevant
         // on active level
-        const auto is_locally_relevant_on_active_level = [&](const auto &cell) {
-          if (cell->is_active())
-            for (const auto v : cell->vertex_indices())
-              if (vertices_owned_by_locally_owned_active_cells
-                    [cell->vertex_index(v)])
-                return true;
-          return false;
-        };
+        const auto is_locally_relevant_on_active_level =
+          [&](const cell_iterator &cell) {
+            if (cell->is_active())
+              for (const auto v : cell->vertex_indices())
+                if (contains(vertices_owned_by_locally_owned_active_cells,
+                             cell->vertex_index(v)))
+                  return true;
+            return false;
+          };
 
-        for (unsigned int level = 0;
-             level < tria.get_triangulation().n_global_levels();
-             ++level)
+        auto marked_cell = marked_cells.begin();
+        for (unsigned int level = 0; level < tria.n_levels(); ++level)
           {
             // collect local vertices on level
-            std::vector<bool> vertices_owned_by_locally_owned_cells_on_level(
-              tria.n_vertices());
-            for (const auto &cell : tria.cell_iterators_on_level(level))
-              if ((construct_multigrid &&
-                   (level_subdomain_id_function(cell) == my_rank)) ||
-                  (cell->is_active() && subdomain_id_function(cell) == my_rank))
-                add_vertices_of_cell_to_vertices_owned_by_locally_owned_cells(
-                  cell, vertices_owned_by_locally_owned_cells_on_level);
+            std::vector<unsigned int> vertices_owned_by_locally_owned_cells;
+            if (construct_multigrid)
+              for (const auto &cell :
+                   CellsByOwner<dim, spacedim>::cells_of_rank(
+                     cells_by_owner.level_cells[level], my_rank))
+                add_vertices_of_cell(cell,
+                                     vertices_owned_by_locally_owned_cells);
+            for (const auto &cell : locally_owned_active_cells)
+              if (cell->level() == static_cast<int>(level))
+                add_vertices_of_cell(cell,
+                                     vertices_owned_by_locally_owned_cells);
+            finalize_vertices(vertices_owned_by_locally_owned_cells);
 
             // helper function to determine if cell is locally relevant
             // on level
-            const auto is_locally_relevant_on_level = [&](const auto &cell) {
-              for (const auto v : cell->vertex_indices())
-                if (vertices_owned_by_locally_owned_cells_on_level
-                      [cell->vertex_index(v)])
-                  return true;
-              return false;
-            };
+            const auto is_locally_relevant_on_level =
+              [&](const cell_iterator &cell) {
+                for (const auto v : cell->vertex_indices())
+                  if (contains(vertices_owned_by_locally_owned_cells,
+                               cell->vertex_index(v)))
+                    return true;
+                return false;
+              };
 
             auto &level_cell_infos = construction_data.cell_infos[level];
-            for (const auto &cell : tria.cell_iterators_on_level(level))
+            for (; marked_cell != marked_cells.end() &&
+                   marked_cell->first == level;
+                 ++marked_cell)
               {
-                // check if cell is locally relevant
-                if (!cell_marked[cell->level()][cell->index()])
-                  continue;
+                const cell_iterator cell(&tria, level, marked_cell->second);
 
                 CellData<dim> cell_info;
 
@@ -776,12 +892,21 @@ namespace TriangulationDescription
                                              coinciding_vertex_groups,
                                              vertex_to_coinciding_vertex_group);
 
+      const auto cells_by_owner = collect_cells_by_owner(
+        tria,
+        subdomain_id_function,
+        level_subdomain_id_function,
+        (settings &
+         TriangulationDescription::Settings::construct_multigrid_hierarchy) !=
+          0u);
+
       return create_description_for_rank<Description<dim, spacedim>>(
         tria,
         subdomain_id_function,
         level_subdomain_id_function,
         coinciding_vertex_groups,
         vertex_to_coinciding_vertex_group,
+        cells_by_owner,
         comm,
         my_rank,
         settings);
@@ -1133,6 +1258,14 @@ namespace TriangulationDescription
                                              coinciding_vertex_groups,
                                              vertex_to_coinciding_vertex_group);
 
+      // Sort the cells by their future owners once, rather than looking at
+      // all cells for each of the future owners.
+      const auto cells_by_owner =
+        collect_cells_by_owner(tria,
+                               cell_to_future_owner,
+                               mg_cell_to_future_owner,
+                               construct_multigrid);
+
       for (const auto rank : future_owners_of_locally_owned_cells)
         descriptions_per_rank.emplace_back(
           create_description_for_rank<DescriptionTemp<dim, spacedim>>(
@@ -1141,6 +1274,7 @@ namespace TriangulationDescription
             mg_cell_to_future_owner,
             coinciding_vertex_groups,
             vertex_to_coinciding_vertex_group,
+            cells_by_owner,
             tria.get_communicator(),
             rank,
             settings));
@@ -1165,6 +1299,178 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+
+    namespace
+    {
+      /**
+       * The identifier at the beginning of files written by
+       * write_descriptions(), followed by the version of the file format.
+       */
+      constexpr char          description_file_magic[] = "deal.II-TriaDescr";
+      constexpr std::uint32_t description_file_version = 1;
+    } // namespace
+
+
+
+    template <int dim, int spacedim>
+    void
+    write_descriptions(const dealii::Triangulation<dim, spacedim> &tria,
+                       const unsigned int                          n_partitions,
+                       const std::string                          &filename,
+                       const TriangulationDescription::Settings    settings)
+    {
+      Assert(
+        (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+           &tria) == nullptr),
+        ExcMessage("This function can only be used with serial triangulations "
+                   "whose subdomain ids describe the partitioning."));
+      AssertThrow(n_partitions > 0,
+                  ExcMessage("The number of partitions must be positive."));
+
+#if DEBUG
+      for (const auto &cell : tria.active_cell_iterators())
+        Assert(cell->subdomain_id() < n_partitions,
+               ExcMessage("You can't have a cell with subdomain_id of " +
+                          std::to_string(cell->subdomain_id()) +
+                          " when writing only " +
+                          std::to_string(n_partitions) + " partitions."));
+#endif
+
+      const auto subdomain_id_function = [](const auto &cell) {
+        return cell->subdomain_id();
+      };
+
+      const auto level_subdomain_id_function = [](const auto &cell) {
+        return cell->level_subdomain_id();
+      };
+
+      // the coinciding vertices are the same for all partitions, so only
+      // collect them once
+      std::map<unsigned int, std::vector<unsigned int>>
+                                           coinciding_vertex_groups;
+      std::map<unsigned int, unsigned int> vertex_to_coinciding_vertex_group;
+      GridTools::collect_coinciding_vertices(tria,
+                                             coinciding_vertex_groups,
+                                             vertex_to_coinciding_vertex_group);
+
+      // sort the cells by partition once, so that setting up the
+      // description of each partition only needs to look at the cells of
+      // that partition and their neighbors
+      const auto cells_by_owner = collect_cells_by_owner(
+        tria,
+        subdomain_id_function,
+        level_subdomain_id_function,
+        (settings &
+         TriangulationDescription::Settings::construct_multigrid_hierarchy) !=
+          0u);
+
+      std::ofstream out(filename, std::ios::binary);
+      AssertThrow(out, ExcFileNotOpen(filename));
+
+      const std::uint32_t header[4] = {description_file_version,
+                                       static_cast<std::uint32_t>(dim),
+                                       static_cast<std::uint32_t>(spacedim),
+                                       n_partitions};
+      out.write(description_file_magic, sizeof(description_file_magic));
+      out.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+      // The index holds the offsets of the descriptions relative to the
+      // end of the index. Reserve space for it now and fill it in once the
+      // sizes of all packed descriptions are known.
+      const std::streampos       index_position = out.tellp();
+      std::vector<std::uint64_t> offsets(n_partitions + 1, 0);
+      out.write(reinterpret_cast<const char *>(offsets.data()),
+                offsets.size() * sizeof(std::uint64_t));
+
+      for (unsigned int p = 0; p < n_partitions; ++p)
+        {
+          const std::vector<char> buffer = dealii::Utilities::pack(
+            create_description_for_rank<Description<dim, spacedim>>(
+              tria,
+              subdomain_id_function,
+              level_subdomain_id_function,
+              coinciding_vertex_groups,
+              vertex_to_coinciding_vertex_group,
+              cells_by_owner,
+              MPI_COMM_SELF,
+              p,
+              settings),
+            false);
+          out.write(buffer.data(), buffer.size());
+          offsets[p + 1] = offsets[p] + buffer.size();
+        }
+
+      out.seekp(index_position);
+      out.write(reinterpret_cast<const char *>(offsets.data()),
+                offsets.size() * sizeof(std::uint64_t));
+      out.close();
+      AssertThrow(out, ExcIO());
+    }
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    load_description(const std::string &filename,
+                     const MPI_Comm     comm,
+                     const unsigned int partition)
+    {
+      std::ifstream in(filename, std::ios::binary);
+      AssertThrow(in, ExcFileNotOpen(filename));
+
+      char          magic[sizeof(description_file_magic)];
+      std::uint32_t header[4];
+      in.read(magic, sizeof(magic));
+      in.read(reinterpret_cast<char *>(header), sizeof(header));
+      AssertThrow(in && std::equal(std::begin(magic),
+                                   std::end(magic),
+                                   std::begin(description_file_magic)),
+                  ExcMessage("The file <" + filename +
+                             "> was not written by write_descriptions()."));
+      AssertThrow(header[0] == description_file_version,
+                  ExcMessage("The file <" + filename +
+                             "> uses an unsupported version of the format."));
+      AssertThrow(header[1] == dim && header[2] == spacedim,
+                  ExcMessage("The file <" + filename +
+                             "> describes a mesh with dim=" +
+                             std::to_string(header[1]) + " and spacedim=" +
+                             std::to_string(header[2]) + "."));
+
+      const unsigned int n_partitions = header[3];
+      const unsigned int my_partition =
+        (partition == numbers::invalid_unsigned_int ?
+           dealii::Utilities::MPI::this_mpi_process(comm) :
+           partition);
+      AssertThrow(my_partition < n_partitions,
+                  ExcMessage("The file <" + filename + "> only contains " +
+                             std::to_string(n_partitions) +
+                             " partitions, but partition " +
+                             std::to_string(my_partition) +
+                             " was requested."));
+
+      // read the two index entries that bound the requested partition and
+      // jump to its data
+      const std::streamoff data_start =
+        static_cast<std::streamoff>(in.tellg()) +
+        (n_partitions + 1) * sizeof(std::uint64_t);
+      std::uint64_t range[2];
+      in.seekg(my_partition * sizeof(std::uint64_t), std::ios::cur);
+      in.read(reinterpret_cast<char *>(range), sizeof(range));
+      AssertThrow(in && range[0] <= range[1], ExcIO());
+
+      std::vector<char> buffer(range[1] - range[0]);
+      in.seekg(data_start + static_cast<std::streamoff>(range[0]));
+      in.read(buffer.data(), buffer.size());
+      AssertThrow(in, ExcIO());
+
+      Description<dim, spacedim> description =
+        dealii::Utilities::unpack<Description<dim, spacedim>>(buffer, false);
+      description.comm = comm;
+      return description;
+    }
+
   } // namespace Utilities
 } // namespace TriangulationDescription
 
@@ -71,7 +71,10 @@ namespace internal
               MemoryConsumption::memory_consumption(boundary_or_material_id) +
               MemoryConsumption::memory_consumption(manifold_id) +
               MemoryConsumption::memory_consumption(refinement_cases) +
-              user_data.capacity() * sizeof(UserData) + sizeof(user_data));
+              (user_data.has_value() ?
+                 user_data.value().capacity() * sizeof(UserData) :
+                 0) +
+              sizeof(user_data));
     }
 
 
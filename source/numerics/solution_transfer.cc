@@ -13,6 +13,8 @@
 // ------------------------------------------------------------------------
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
@@ -155,45 +157,7 @@ SolutionTransfer<dim, VectorType, spacedim>::refine_interpolate(
                                                                    spacedim>
     subdomain_modifier(dof_handler->get_triangulation());
 
-  Vector<typename VectorType::value_type> local_values(0);
-
-  typename std::map<std::pair<unsigned int, unsigned int>,
-                    Pointerstruct>::const_iterator pointerstruct,
-    cell_map_end = cell_map.end();
-
-  for (const auto &cell : dof_handler->cell_iterators())
-    {
-      pointerstruct =
-        cell_map.find(std::make_pair(cell->level(), cell->index()));
-
-      if (pointerstruct != cell_map_end)
-        // this cell was refined or not
-        // touched at all, so we can get
-        // the new values by just setting
-        // or interpolating to the children,
-        // which is both done by one
-        // function
-        {
-          const unsigned int this_fe_index =
-            pointerstruct->second.active_fe_index;
-          const unsigned int dofs_per_cell =
-            cell->get_dof_handler().get_fe(this_fe_index).n_dofs_per_cell();
-          local_values.reinit(dofs_per_cell, true);
-
-          // make sure that the size of the stored indices is the same as
-          // dofs_per_cell. since we store the desired fe_index, we know
-          // what this size should be
-          Assert(dofs_per_cell == (*pointerstruct->second.indices_ptr).size(),
-                 ExcInternalError());
-          for (unsigned int i = 0; i < dofs_per_cell; ++i)
-            local_values(i) = internal::ElementAccess<VectorType>::get(
-              in, (*pointerstruct->second.indices_ptr)[i]);
-          cell->set_dof_values_by_interpolation(local_values,
-                                                out,
-                                                this_fe_index,
-                                                true);
-        }
-    }
+  interpolate_on_cells({&in}, {&out});
 }
 
 
@@ -269,10 +233,312 @@ namespace internal
           restriction_is_additive[f][i] = fe[f].restriction_is_additive(i);
       }
   }
+
+
+
+  namespace SolutionTransferImplementation
+  {
+    /**
+     * The values that SolutionTransfer computes from one of the cells it
+     * stores data for: the active cells on which values are set, and the
+     * values of each of the vectors on these cells.
+     */
+    template <int dim, int spacedim, typename Number>
+    struct CopyData
+    {
+      std::vector<typename DoFHandler<dim, spacedim>::cell_iterator> cells;
+      std::vector<std::vector<Vector<Number>>>                       values;
+      bool perform_check = false;
+    };
+
+
+
+    /**
+     * Prolong the values of all vectors, given in the space of the element
+     * with index @p fe_index on @p cell, to all active descendants of the
+     * cell, and store the results in @p copy_data. This does the same as
+     * DoFCellAccessor::set_dof_values_by_interpolation(), but treats all
+     * vectors at once and takes the interpolation matrices between the
+     * elements of an hp::FECollection from @p interpolation_hp rather than
+     * computing them on every cell.
+     */
+    template <int dim, int spacedim, typename Number>
+    void
+    prolong_to_active_cells(
+      const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+      const std::vector<Vector<Number>>                       &local_values,
+      const unsigned int                                       fe_index,
+      const dealii::Table<2, FullMatrix<double>>              &interpolation_hp,
+      CopyData<dim, spacedim, Number>                         &copy_data)
+    {
+      if (cell->is_active())
+        {
+          if (cell->is_artificial())
+            return;
+
+          copy_data.cells.push_back(cell);
+          if (cell->get_dof_handler().has_hp_capabilities() == false ||
+              fe_index == cell->active_fe_index())
+            copy_data.values.push_back(local_values);
+          else
+            {
+              copy_data.values.emplace_back(
+                local_values.size(),
+                Vector<Number>(cell->get_fe().n_dofs_per_cell()));
+              if (cell->get_fe().n_dofs_per_cell() == 0 ||
+                  local_values[0].size() == 0)
+                return;
+
+              const FullMatrix<double> &interpolation =
+                interpolation_hp(cell->active_fe_index(), fe_index);
+              AssertThrow(interpolation.empty() == false,
+                          (typename FiniteElement<dim, spacedim>::
+                             ExcInterpolationNotImplemented()));
+              for (unsigned int j = 0; j < local_values.size(); ++j)
+                interpolation.vmult(copy_data.values.back()[j],
+                                    local_values[j]);
+            }
+        }
+      else
+        {
+          const FiniteElement<dim, spacedim> &fe =
+            cell->get_dof_handler().get_fe(fe_index);
+          std::vector<Vector<Number>> child_values(
+            local_values.size(), Vector<Number>(fe.n_dofs_per_cell()));
+
+          for (unsigned int child = 0; child < cell->n_children(); ++child)
+            {
+              if (fe.n_dofs_per_cell() > 0)
+                {
+                  const FullMatrix<double> &prolongation =
+                    fe.get_prolongation_matrix(child, cell->refinement_case());
+                  for (unsigned int j = 0; j < local_values.size(); ++j)
+                    prolongation.vmult(child_values[j], local_values[j]);
+                }
+              prolong_to_active_cells<dim, spacedim>(cell->child(child),
+                                                     child_values,
+                                                     fe_index,
+                                                     interpolation_hp,
+                                                     copy_data);
+            }
+        }
+    }
+
+
+
+    /**
+     * Restrict the values of all vectors in @p all_in from the (active)
+     * children of @p cell to the space of the element with index @p fe_index
+     * on @p cell. This does the same as
+     * DoFCellAccessor::get_interpolated_dof_values(), but treats all vectors
+     * at once and takes the interpolation matrices between the elements of
+     * an hp::FECollection from @p interpolation_hp rather than computing
+     * them on every cell.
+     */
+    template <int dim, int spacedim, typename VectorType>
+    void
+    restrict_from_children(
+      const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+      const std::vector<VectorType>                           &all_in,
+      const unsigned int                                       fe_index,
+      const dealii::Table<2, FullMatrix<double>>              &interpolation_hp,
+      const std::vector<std::vector<bool>> &restriction_is_additive,
+      std::vector<Vector<typename VectorType::value_type>> &values)
+    {
+      using Number = typename VectorType::value_type;
+
+      const FiniteElement<dim, spacedim> &fe =
+        cell->get_dof_handler().get_fe(fe_index);
+      const unsigned int dofs_per_cell = fe.n_dofs_per_cell();
+      if (dofs_per_cell == 0)
+        return;
+
+      Vector<Number> child_values, interpolated_values(dofs_per_cell),
+        restricted_values(dofs_per_cell);
+      for (unsigned int child = 0; child < cell->n_children(); ++child)
+        {
+          const auto &child_cell = cell->child(child);
+          Assert(child_cell->is_active(), ExcInternalError());
+
+          const bool needs_interpolation =
+            cell->get_dof_handler().has_hp_capabilities() &&
+            child_cell->active_fe_index() != fe_index;
+          const FullMatrix<double> &restriction =
+            fe.get_restriction_matrix(child, cell->refinement_case());
+
+          child_values.reinit(child_cell->get_fe().n_dofs_per_cell());
+          for (unsigned int j = 0; j < all_in.size(); ++j)
+            {
+              if (child_values.size() > 0)
+                child_cell->get_dof_values(all_in[j], child_values);
+
+              if (needs_interpolation)
+                {
+                  if (child_values.size() == 0)
+                    interpolated_values = Number();
+                  else
+                    {
+                      const FullMatrix<double> &interpolation =
+                        interpolation_hp(fe_index,
+                                         child_cell->active_fe_index());
+                      AssertThrow(interpolation.empty() == false,
+                                  (typename FiniteElement<dim, spacedim>::
+                                     ExcInterpolationNotImplemented()));
+                      interpolation.vmult(interpolated_values, child_values);
+                    }
+                  restriction.vmult(restricted_values, interpolated_values);
+                }
+              else
+                restriction.vmult(restricted_values, child_values);
+
+              // add up or set the values, see the discussion in
+              // DoFCellAccessor::get_interpolated_dof_values()
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                if (restriction_is_additive[fe_index][i])
+                  values[j](i) += restricted_values(i);
+                else if (restricted_values(i) != Number())
+                  values[j](i) = restricted_values(i);
+            }
+        }
+    }
+  } // namespace SolutionTransferImplementation
 } // namespace internal
 
 
 
+template <int dim, typename VectorType, int spacedim>
+void
+SolutionTransfer<dim, VectorType, spacedim>::interpolate_on_cells(
+  const std::vector<const VectorType *> &all_in,
+  const std::vector<VectorType *>       &all_out) const
+{
+  using Number   = typename VectorType::value_type;
+  using CopyData = internal::SolutionTransferImplementation::
+    CopyData<dim, spacedim, Number>;
+
+  Table<2, FullMatrix<double>> interpolation_hp;
+  internal::extract_interpolation_matrices(*dof_handler, interpolation_hp);
+
+  // compute the new values on the cells in parallel, each thread with its own
+  // buffer for the values read from the input vectors. since neighboring
+  // cells share degrees of freedom, the values are then written into the
+  // output vectors sequentially, in the same order as the cells are stored in
+  // cell_map
+  using MapIterator =
+    typename std::map<std::pair<unsigned int, unsigned int>,
+                      Pointerstruct>::const_iterator;
+
+  auto worker = [&](const MapIterator             &entry,
+                    std::vector<Vector<Number>> &local_values,
+                    CopyData                    &copy_data) {
+    copy_data.cells.clear();
+    copy_data.values.clear();
+
+    const typename DoFHandler<dim, spacedim>::cell_iterator cell(
+      &dof_handler->get_triangulation(),
+      entry->first.first,
+      entry->first.second,
+      dof_handler.get());
+
+    const std::vector<types::global_dof_index> *const indexptr =
+      entry->second.indices_ptr;
+    const std::vector<Vector<Number>> *const valuesptr =
+      entry->second.dof_values_ptr;
+    const unsigned int old_fe_index = entry->second.active_fe_index;
+
+    // cell stayed as it was or was refined: get the values of each of the
+    // input data vectors on this cell and prolong them to its children
+    if (indexptr != nullptr)
+      {
+        Assert(valuesptr == nullptr, ExcInternalError());
+
+        local_values.resize(all_in.size());
+        for (unsigned int j = 0; j < all_in.size(); ++j)
+          {
+            local_values[j].reinit(indexptr->size(), true);
+            for (unsigned int i = 0; i < indexptr->size(); ++i)
+              local_values[j](i) =
+                internal::ElementAccess<VectorType>::get(*all_in[j],
+                                                         (*indexptr)[i]);
+          }
+
+        copy_data.perform_check = true;
+        internal::SolutionTransferImplementation::
+          prolong_to_active_cells<dim, spacedim>(
+            cell, local_values, old_fe_index, interpolation_hp, copy_data);
+      }
+    // the children of this cell were deleted: take the stored values,
+    // interpolated to the element now used on the cell if necessary
+    else if (valuesptr != nullptr)
+      {
+        Assert(!cell->has_children(), ExcInternalError());
+
+        copy_data.perform_check = false;
+        copy_data.cells.push_back(cell);
+
+        const unsigned int active_fe_index = cell->active_fe_index();
+        if (active_fe_index != old_fe_index)
+          {
+            const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+            copy_data.values.emplace_back(all_in.size(),
+                                          Vector<Number>(dofs_per_cell));
+
+            const FullMatrix<double> &interpolation_matrix =
+              interpolation_hp(active_fe_index, old_fe_index);
+            // The interpolation matrix might be empty when using
+            // FE_Nothing, in which case we set the values to zero.
+            if (!interpolation_matrix.empty())
+              for (unsigned int j = 0; j < all_in.size(); ++j)
+                {
+                  AssertDimension((*valuesptr)[j].size(),
+                                  interpolation_matrix.n());
+                  AssertDimension(dofs_per_cell, interpolation_matrix.m());
+                  interpolation_matrix.vmult(copy_data.values.back()[j],
+                                             (*valuesptr)[j]);
+                }
+          }
+        else
+          copy_data.values.emplace_back(valuesptr->begin(),
+                                        valuesptr->begin() + all_in.size());
+      }
+    // undefined status
+    else
+      DEAL_II_ASSERT_UNREACHABLE();
+  };
+
+  std::vector<types::global_dof_index> dof_indices;
+  auto copier = [&](const CopyData &copy_data) {
+    for (unsigned int c = 0; c < copy_data.cells.size(); ++c)
+      {
+        const auto &cell = copy_data.cells[c];
+        if (copy_data.perform_check)
+          for (unsigned int j = 0; j < all_out.size(); ++j)
+            cell->set_dof_values_by_interpolation(copy_data.values[c][j],
+                                                  *all_out[j],
+                                                  cell->active_fe_index(),
+                                                  true);
+        else
+          {
+            dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_indices(dof_indices);
+            for (unsigned int j = 0; j < all_out.size(); ++j)
+              for (unsigned int i = 0; i < dof_indices.size(); ++i)
+                internal::ElementAccess<VectorType>::set(
+                  copy_data.values[c][j](i), dof_indices[i], *all_out[j]);
+          }
+      }
+  };
+
+  WorkStream::run(cell_map.begin(),
+                  cell_map.end(),
+                  worker,
+                  copier,
+                  std::vector<Vector<Number>>(),
+                  CopyData());
+}
+
+
+
 template <int dim, typename VectorType, int spacedim>
 void
 SolutionTransfer<dim, VectorType, spacedim>::
@@ -342,6 +608,9 @@ SolutionTransfer<dim, VectorType, spacedim>::
     n_coarsen_fathers,
     std::vector<Vector<typename VectorType::value_type>>(in_size))
     .swap(dof_values_on_cell);
+  std::vector<
+    std::pair<typename DoFHandler<dim, spacedim>::cell_iterator, unsigned int>>
+    coarsen_fathers(n_coarsen_fathers);
 
   Table<2, FullMatrix<double>>   interpolation_hp;
   std::vector<std::vector<bool>> restriction_is_additive;
@@ -406,16 +675,8 @@ SolutionTransfer<dim, VectorType, spacedim>::
             in_size, Vector<typename VectorType::value_type>(dofs_per_cell))
             .swap(dof_values_on_cell[n_cf]);
 
-
-          // store the data of each of the input vectors. get this data
-          // as interpolated onto a finite element space that encompasses
-          // that of all the children. note that
-          // cell->get_interpolated_dof_values already does all of the
-          // interpolations between spaces
-          for (unsigned int j = 0; j < in_size; ++j)
-            cell->get_interpolated_dof_values(all_in[j],
-                                              dof_values_on_cell[n_cf][j],
-                                              target_fe_index);
+          // the values are filled in below, once we know all cells
+          coarsen_fathers[n_cf] = std::make_pair(cell, target_fe_index);
           cell_map[std::make_pair(cell->level(), cell->index())] =
             Pointerstruct(&dof_values_on_cell[n_cf], target_fe_index);
           ++n_cf;
@@ -424,6 +685,28 @@ SolutionTransfer<dim, VectorType, spacedim>::
   Assert(n_sr == n_cells_to_stay_or_refine, ExcInternalError());
   Assert(n_cf == n_coarsen_fathers, ExcInternalError());
 
+  // store the data of each of the input vectors on the cells whose children
+  // will be coarsened away. get this data as interpolated onto a finite
+  // element space that encompasses that of all the children. each cell
+  // writes into its own slot of dof_values_on_cell, so we can work on the
+  // cells in parallel
+  parallel::apply_to_subranges(
+    0U,
+    n_coarsen_fathers,
+    [&](const unsigned int begin, const unsigned int end) {
+      for (unsigned int c = begin; c < end; ++c)
+        internal::SolutionTransferImplementation::restrict_from_children<
+          dim,
+          spacedim>(
+          coarsen_fathers[c].first,
+          all_in,
+          coarsen_fathers[c].second,
+          interpolation_hp,
+          restriction_is_additive,
+          dof_values_on_cell[c]);
+    },
+    16);
+
   prepared_for = coarsening_and_refinement;
 }
 
@@ -475,112 +758,14 @@ SolutionTransfer<dim, VectorType, spacedim>::interpolate(
                                                                    spacedim>
     subdomain_modifier(dof_handler->get_triangulation());
 
-  Vector<typename VectorType::value_type> local_values;
-  std::vector<types::global_dof_index>    dofs;
-
-  typename std::map<std::pair<unsigned int, unsigned int>,
-                    Pointerstruct>::const_iterator pointerstruct,
-    cell_map_end = cell_map.end();
-
-  Table<2, FullMatrix<double>> interpolation_hp;
-  internal::extract_interpolation_matrices(*dof_handler, interpolation_hp);
-  Vector<typename VectorType::value_type> tmp, tmp2;
-
-  for (const auto &cell : dof_handler->cell_iterators())
+  std::vector<const VectorType *> in_pointers(size);
+  std::vector<VectorType *>       out_pointers(size);
+  for (unsigned int j = 0; j < size; ++j)
     {
-      pointerstruct =
-        cell_map.find(std::make_pair(cell->level(), cell->index()));
-
-      if (pointerstruct != cell_map_end)
-        {
-          const std::vector<types::global_dof_index> *const indexptr =
-            pointerstruct->second.indices_ptr;
-
-          const std::vector<Vector<typename VectorType::value_type>>
-            *const valuesptr = pointerstruct->second.dof_values_ptr;
-
-          // cell stayed as it was or was refined
-          if (indexptr != nullptr)
-            {
-              Assert(valuesptr == nullptr, ExcInternalError());
-
-              const unsigned int old_fe_index =
-                pointerstruct->second.active_fe_index;
-
-              // get the values of each of the input data vectors on this cell
-              // and prolong it to its children
-              unsigned int in_size = indexptr->size();
-              for (unsigned int j = 0; j < size; ++j)
-                {
-                  tmp.reinit(in_size, true);
-                  for (unsigned int i = 0; i < in_size; ++i)
-                    tmp(i) =
-                      internal::ElementAccess<VectorType>::get(all_in[j],
-                                                               (*indexptr)[i]);
-
-                  cell->set_dof_values_by_interpolation(tmp,
-                                                        all_out[j],
-                                                        old_fe_index,
-                                                        true);
-                }
-            }
-          else if (valuesptr)
-            // the children of this cell were deleted
-            {
-              Assert(!cell->has_children(), ExcInternalError());
-              Assert(indexptr == nullptr, ExcInternalError());
-
-              const unsigned int dofs_per_cell =
-                cell->get_fe().n_dofs_per_cell();
-              dofs.resize(dofs_per_cell);
-              // get the local
-              // indices
-              cell->get_dof_indices(dofs);
-
-              // distribute the stored data to the new vectors
-              for (unsigned int j = 0; j < size; ++j)
-                {
-                  // make sure that the size of the stored indices is the same
-                  // as dofs_per_cell. this is kind of a test if we use the same
-                  // FE in the hp-case. to really do that test we would have to
-                  // store the fe_index of all cells
-                  const Vector<typename VectorType::value_type> *data = nullptr;
-                  const unsigned int active_fe_index = cell->active_fe_index();
-                  if (active_fe_index != pointerstruct->second.active_fe_index)
-                    {
-                      const unsigned int old_index =
-                        pointerstruct->second.active_fe_index;
-                      const FullMatrix<double> &interpolation_matrix =
-                        interpolation_hp(active_fe_index, old_index);
-                      // The interpolation matrix might be empty when using
-                      // FE_Nothing.
-                      if (interpolation_matrix.empty())
-                        tmp.reinit(dofs_per_cell, false);
-                      else
-                        {
-                          tmp.reinit(dofs_per_cell, true);
-                          AssertDimension((*valuesptr)[j].size(),
-                                          interpolation_matrix.n());
-                          AssertDimension(tmp.size(), interpolation_matrix.m());
-                          interpolation_matrix.vmult(tmp, (*valuesptr)[j]);
-                        }
-                      data = &tmp;
-                    }
-                  else
-                    data = &(*valuesptr)[j];
-
-
-                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
-                    internal::ElementAccess<VectorType>::set((*data)(i),
-                                                             dofs[i],
-                                                             all_out[j]);
-                }
-            }
-          // undefined status
-          else
-            DEAL_II_ASSERT_UNREACHABLE();
-        }
+      in_pointers[j]  = &all_in[j];
+      out_pointers[j] = &all_out[j];
     }
+  interpolate_on_cells(in_pointers, out_pointers);
 
   // We have written into the output vectors. If this was a PETSc vector, for
   // example, then we need to compress these to make future operations safe:
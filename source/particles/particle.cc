@@ -241,6 +241,11 @@ namespace Particles
           *pdata = particle_properties[i];
       }
 
+    // Write property columns
+    if (property_pool->n_property_columns() > 0)
+      return property_pool->write_property_columns_to_memory(
+        property_pool_handle, pdata);
+
     return static_cast<void *>(pdata);
   }
 
@@ -276,6 +281,11 @@ namespace Particles
           particle_properties[i] = *pdata++;
       }
 
+    // See if there are property columns to load
+    if (property_pool->n_property_columns() > 0)
+      return property_pool->read_property_columns_from_memory(
+        property_pool_handle, pdata);
+
     return static_cast<const void *>(pdata);
   }
 
@@ -295,6 +305,7 @@ namespace Particles
           property_pool->get_properties(property_pool_handle);
         size += sizeof(double) * particle_properties.size();
       }
+    size += property_pool->property_columns_size_in_bytes();
     return size;
   }
 
@@ -12,6 +12,8 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -62,6 +64,8 @@ namespace Particles
     , number_of_locally_owned_particles(0)
     , global_max_particles_per_cell(0)
     , next_free_particle_index(0)
+    , storage_compaction_threshold(std::numeric_limits<double>::infinity())
+    , n_unsorted_storage_modifications(0)
     , size_callback()
     , store_callback()
     , load_callback()
@@ -86,6 +90,8 @@ namespace Particles
     , number_of_locally_owned_particles(0)
     , global_max_particles_per_cell(0)
     , next_free_particle_index(0)
+    , storage_compaction_threshold(std::numeric_limits<double>::infinity())
+    , n_unsorted_storage_modifications(0)
     , size_callback()
     , store_callback()
     , load_callback()
@@ -165,6 +171,10 @@ namespace Particles
     global_max_particles_per_cell =
       particle_handler.global_max_particles_per_cell;
     next_free_particle_index = particle_handler.next_free_particle_index;
+    storage_compaction_threshold =
+      particle_handler.storage_compaction_threshold;
+    n_unsorted_storage_modifications =
+      particle_handler.n_unsorted_storage_modifications;
 
     // Manually copy over the particles because we do not want to touch the
     // anchor iterators set by initialize()
@@ -217,6 +227,7 @@ namespace Particles
     // the particle properties have already been deleted by their destructor,
     // but the memory is still allocated. Return the memory as well.
     property_pool->clear();
+    n_unsorted_storage_modifications = 0;
   }
 
 
@@ -504,6 +515,7 @@ namespace Particles
     const bool owned_cell = cell->is_locally_owned();
     if (owned_cell)
       --number_of_locally_owned_particles;
+    ++n_unsorted_storage_modifications;
 
     if (particles_on_cell.size() > 1)
       {
@@ -525,6 +537,18 @@ namespace Particles
   ParticleHandler<dim, spacedim>::remove_particles(
     const std::vector<ParticleHandler<dim, spacedim>::particle_iterator>
       &particles_to_remove)
+  {
+    remove_particles_without_compaction(particles_to_remove);
+    compact_particle_storage_if_fragmented();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::remove_particles_without_compaction(
+    const std::vector<ParticleHandler<dim, spacedim>::particle_iterator>
+      &particles_to_remove)
   {
     // We need to remove particles backwards on each cell to keep the particle
     // iterators alive as we keep removing particles on the same cell. To
@@ -612,6 +636,7 @@ namespace Particles
         cache->particles.push_back(handle);
         Assert(cache->cell == cell, ExcInternalError());
       }
+    ++n_unsorted_storage_modifications;
     return particle_iterator(cache,
                              *property_pool,
                              cache->particles.size() - 1);
@@ -690,6 +715,7 @@ namespace Particles
       insert_particle(cell_and_particle.second, cell_and_particle.first);
 
     update_cached_numbers();
+    compact_particle_storage_if_fragmented();
   }
 
 
@@ -754,6 +780,7 @@ namespace Particles
                         cells[i]);
 
     update_cached_numbers();
+    compact_particle_storage_if_fragmented();
   }
 
 
@@ -980,6 +1007,7 @@ namespace Particles
       }
 
     update_cached_numbers();
+    compact_particle_storage_if_fragmented();
 
     return original_process_to_local_particle_indices;
   }
@@ -1220,56 +1248,81 @@ namespace Particles
     // TODO: Extend this function to allow keeping particles on other
     // processes around (with an invalid cell).
 
-    std::vector<particle_iterator> particles_out_of_cell;
-
-    // Reserve some space for particles that need sorting to avoid frequent
-    // re-allocation. Guess 25% of particles need sorting. Balance memory
-    // overhead and performance.
-    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
-
-    // Now update the reference locations of the moved particles
-    std::vector<Point<spacedim>> real_locations;
-    std::vector<Point<dim>>      reference_locations;
-    real_locations.reserve(global_max_particles_per_cell);
-    reference_locations.reserve(global_max_particles_per_cell);
-
+    // Collect the locally owned cells that contain particles, in the order
+    // of the active cells. Particles can be inserted into arbitrary cells,
+    // e.g. if their cell is not known. However, for artificial cells we can
+    // not evaluate the reference position of particles. Do not sort
+    // particles that are not locally owned, because they will be sorted by
+    // the process that owns them.
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      cells_with_particles;
     for (const auto &cell : triangulation->active_cell_iterators())
-      {
-        // Particles can be inserted into arbitrary cells, e.g. if their cell is
-        // not known. However, for artificial cells we can not evaluate
-        // the reference position of particles. Do not sort particles that are
-        // not locally owned, because they will be sorted by the process that
-        // owns them.
-        if (cell->is_locally_owned() == false)
+      if (cell->is_locally_owned() && n_particles_in_cell(cell) > 0)
+        cells_with_particles.push_back(cell);
+
+    // Now update the reference locations of the particles. The cells are
+    // independent of each other, so we can work on them in parallel. Every
+    // task transforms the particles of all of its cells with a single call
+    // to the mapping, which allows the mapping to vectorize across cells
+    // with few particles. The particles that left their cell are collected
+    // in the entries of 'out_of_cell_by_cell' that belong to the cells of
+    // the task, which we concatenate afterwards in the order of the cells.
+    std::vector<std::vector<particle_iterator>> out_of_cell_by_cell(
+      cells_with_particles.size());
+
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells_with_particles.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+                                     cells;
+        std::vector<Point<spacedim>> real_locations;
+        std::vector<Point<dim>>      reference_locations;
+
+        for (unsigned int c = begin; c < end; ++c)
           {
-            continue;
+            const auto &cell = cells_with_particles[c];
+            for (const auto &particle : particles_in_cell(cell))
+              {
+                cells.push_back(cell);
+                real_locations.push_back(particle.get_location());
+              }
           }
 
-        const unsigned int n_pic = n_particles_in_cell(cell);
-        auto               pic   = particles_in_cell(cell);
-
-        real_locations.clear();
-        for (const auto &particle : pic)
-          real_locations.push_back(particle.get_location());
+        reference_locations.resize(real_locations.size());
+        mapping->transform_points_real_to_unit_cells(cells,
+                                                     real_locations,
+                                                     reference_locations);
 
-        reference_locations.resize(n_pic);
-        mapping->transform_points_real_to_unit_cell(cell,
-                                                    real_locations,
-                                                    reference_locations);
-
-        auto particle = pic.begin();
-        for (const auto &p_unit : reference_locations)
+        auto p_unit = reference_locations.begin();
+        for (unsigned int c = begin; c < end; ++c)
           {
-            if (numbers::is_finite(p_unit[0]) &&
-                GeometryInfo<dim>::is_inside_unit_cell(p_unit,
-                                                       tolerance_inside_cell))
-              particle->set_reference_location(p_unit);
-            else
-              particles_out_of_cell.push_back(particle);
-
-            ++particle;
+            const auto pic = particles_in_cell(cells_with_particles[c]);
+            for (auto particle = pic.begin(); particle != pic.end();
+                 ++particle, ++p_unit)
+              {
+                if (numbers::is_finite((*p_unit)[0]) &&
+                    GeometryInfo<dim>::is_inside_unit_cell(
+                      *p_unit, tolerance_inside_cell))
+                  particle->set_reference_location(*p_unit);
+                else
+                  out_of_cell_by_cell[c].push_back(particle);
+              }
           }
-      }
+      },
+      /* grainsize = */ 32);
+
+    std::vector<particle_iterator> particles_out_of_cell;
+
+    // Reserve some space for particles that need sorting to avoid frequent
+    // re-allocation. Guess 25% of particles need sorting. Balance memory
+    // overhead and performance.
+    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
+    for (const auto &out_of_cell : out_of_cell_by_cell)
+      particles_out_of_cell.insert(particles_out_of_cell.end(),
+                                   out_of_cell.begin(),
+                                   out_of_cell.end());
+    out_of_cell_by_cell.clear();
 
     // There are three reasons why a particle is not in its old cell:
     // It moved to another cell, to another subdomain or it left the mesh.
@@ -1317,147 +1370,182 @@ namespace Particles
         &vertex_to_cell_centers =
           triangulation_cache->get_vertex_to_cell_centers_directions();
 
-      std::vector<unsigned int> search_order;
-
-      // Reuse these vectors below, but only with a single element.
-      // Avoid resizing for every particle.
-      Point<dim>      invalid_reference_point;
-      Point<spacedim> invalid_point;
-      invalid_reference_point[0] = std::numeric_limits<double>::infinity();
-      invalid_point[0]           = std::numeric_limits<double>::infinity();
-      reference_locations.resize(1, invalid_reference_point);
-      real_locations.resize(1, invalid_point);
-
-      // Find the cells that the particles moved to.
-      for (auto &out_particle : particles_out_of_cell)
-        {
-          // make a copy of the current cell, since we will modify the
-          // variable current_cell below, but we need the original in
-          // the case the particle is not found
-          auto current_cell = out_particle->get_surrounding_cell();
-
-          real_locations[0] = out_particle->get_location();
-
-          // Record if the new cell was found
-          bool found_cell = false;
-
-          // Check if the particle is in one of the old cell's neighbors
-          // that are adjacent to the closest vertex
-          const unsigned int closest_vertex =
-            GridTools::find_closest_vertex_of_cell<dim, spacedim>(
-              current_cell, out_particle->get_location(), *mapping);
-          const unsigned int closest_vertex_index =
-            current_cell->vertex_index(closest_vertex);
-
-          const auto &candidate_cells = vertex_to_cells[closest_vertex_index];
-          const unsigned int n_candidate_cells = candidate_cells.size();
-
-          // The order of searching through the candidate cells matters for
-          // performance reasons. Start with a simple order.
-          search_order.resize(n_candidate_cells);
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            search_order[i] = i;
-
-          // If the particle is not on a vertex, we can do better by
-          // sorting the candidate cells by alignment with
-          // the vertex_to_particle direction.
-          Tensor<1, spacedim> vertex_to_particle =
-            out_particle->get_location() - current_cell->vertex(closest_vertex);
-
-          // Only do this if the particle is not on a vertex, otherwise we
-          // cannot normalize
-          if (vertex_to_particle.norm_square() >
-              1e4 * std::numeric_limits<double>::epsilon() *
-                std::numeric_limits<double>::epsilon() *
-                vertex_to_cell_centers[closest_vertex_index][0].norm_square())
+      // Find the cells that the particles moved to. The search only reads
+      // the triangulation and the particle locations, so we do it in
+      // parallel, with scratch arrays local to each task. Every task stores
+      // the cell it found for a particle (or an invalid iterator if there is
+      // none) and the new reference location in the entries belonging to
+      // that particle. The particle container and the send buffers are then
+      // updated in a sequential loop, which makes the result independent of
+      // how the work was scheduled.
+      const unsigned int n_particles_out_of_cell = particles_out_of_cell.size();
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                              new_cells(n_particles_out_of_cell);
+      std::vector<Point<dim>> new_reference_locations(n_particles_out_of_cell);
+
+      parallel::apply_to_subranges(
+        0U,
+        n_particles_out_of_cell,
+        [&](const unsigned int begin, const unsigned int end) {
+          std::vector<unsigned int> search_order;
+
+          // Reuse these vectors below, but only with a single element.
+          // Avoid resizing for every particle.
+          Point<dim>      invalid_reference_point;
+          Point<spacedim> invalid_point;
+          invalid_reference_point[0] = std::numeric_limits<double>::infinity();
+          invalid_point[0]           = std::numeric_limits<double>::infinity();
+          std::vector<Point<dim>> reference_locations(1,
+                                                      invalid_reference_point);
+          std::vector<Point<spacedim>> real_locations(1, invalid_point);
+
+          for (unsigned int p = begin; p < end; ++p)
             {
-              vertex_to_particle /= vertex_to_particle.norm();
-              const auto &vertex_to_cells =
-                vertex_to_cell_centers[closest_vertex_index];
-
-              std::sort(search_order.begin(),
-                        search_order.end(),
-                        [&vertex_to_particle,
-                         &vertex_to_cells](const unsigned int a,
-                                           const unsigned int b) {
-                          return compare_particle_association(
-                            a, b, vertex_to_particle, vertex_to_cells);
-                        });
-            }
+              const particle_iterator &out_particle = particles_out_of_cell[p];
+
+              // make a copy of the current cell, since we will modify the
+              // variable current_cell below, but we need the original in
+              // the case the particle is not found
+              auto current_cell = out_particle->get_surrounding_cell();
+
+              real_locations[0] = out_particle->get_location();
+
+              // Record if the new cell was found
+              bool found_cell = false;
+
+              // Check if the particle is in one of the old cell's neighbors
+              // that are adjacent to the closest vertex
+              const unsigned int closest_vertex =
+                GridTools::find_closest_vertex_of_cell<dim, spacedim>(
+                  current_cell, out_particle->get_location(), *mapping);
+              const unsigned int closest_vertex_index =
+                current_cell->vertex_index(closest_vertex);
+
+              const auto &candidate_cells =
+                vertex_to_cells[closest_vertex_index];
+              const unsigned int n_candidate_cells = candidate_cells.size();
+
+              // The order of searching through the candidate cells matters for
+              // performance reasons. Start with a simple order.
+              search_order.resize(n_candidate_cells);
+              for (unsigned int i = 0; i < n_candidate_cells; ++i)
+                search_order[i] = i;
+
+              // If the particle is not on a vertex, we can do better by
+              // sorting the candidate cells by alignment with
+              // the vertex_to_particle direction.
+              Tensor<1, spacedim> vertex_to_particle =
+                out_particle->get_location() -
+                current_cell->vertex(closest_vertex);
+
+              // Only do this if the particle is not on a vertex, otherwise we
+              // cannot normalize
+              if (vertex_to_particle.norm_square() >
+                  1e4 * std::numeric_limits<double>::epsilon() *
+                    std::numeric_limits<double>::epsilon() *
+                    vertex_to_cell_centers[closest_vertex_index][0]
+                      .norm_square())
+                {
+                  vertex_to_particle /= vertex_to_particle.norm();
+                  const auto &vertex_to_cells =
+                    vertex_to_cell_centers[closest_vertex_index];
+
+                  std::sort(search_order.begin(),
+                            search_order.end(),
+                            [&vertex_to_particle,
+                             &vertex_to_cells](const unsigned int a,
+                                               const unsigned int b) {
+                              return compare_particle_association(
+                                a, b, vertex_to_particle, vertex_to_cells);
+                            });
+                }
 
-          // Search all of the candidate cells according to the determined
-          // order. Most likely we will find the particle in them.
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            {
-              typename std::set<
-                typename Triangulation<dim, spacedim>::active_cell_iterator>::
-                const_iterator candidate_cell = candidate_cells.begin();
+              // Search all of the candidate cells according to the determined
+              // order. Most likely we will find the particle in them.
+              for (unsigned int i = 0; i < n_candidate_cells; ++i)
+                {
+                  typename std::set<
+                    typename Triangulation<dim, spacedim>::
+                      active_cell_iterator>::const_iterator candidate_cell =
+                    candidate_cells.begin();
 
-              std::advance(candidate_cell, search_order[i]);
-              mapping->transform_points_real_to_unit_cell(*candidate_cell,
-                                                          real_locations,
-                                                          reference_locations);
+                  std::advance(candidate_cell, search_order[i]);
+                  mapping->transform_points_real_to_unit_cell(
+                    *candidate_cell, real_locations, reference_locations);
 
-              if (GeometryInfo<dim>::is_inside_unit_cell(reference_locations[0],
-                                                         tolerance_inside_cell))
-                {
-                  current_cell = *candidate_cell;
-                  found_cell   = true;
-                  break;
+                  if (GeometryInfo<dim>::is_inside_unit_cell(
+                        reference_locations[0], tolerance_inside_cell))
+                    {
+                      current_cell = *candidate_cell;
+                      found_cell   = true;
+                      break;
+                    }
                 }
-            }
 
-          // If we did not find a cell the particle is not in a neighbor of
-          // its old cell. Look for the new cell in the whole local domain.
-          // This case should be rare.
-          if (!found_cell)
-            {
-              // For some clang-based compilers and boost versions the call to
-              // RTree::query doesn't compile. We use a slower implementation as
-              // workaround.
-              // This is fixed in boost in
-              // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+              // If we did not find a cell the particle is not in a neighbor of
+              // its old cell. Look for the new cell in the whole local domain.
+              // This case should be rare.
+              if (!found_cell)
+                {
+                  // For some clang-based compilers and boost versions the call
+                  // to RTree::query doesn't compile. We use a slower
+                  // implementation as workaround.
+                  // This is fixed in boost in
+                  // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
 #if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
   !(defined(__clang_major__) && __clang_major__ >= 16) || \
   BOOST_VERSION >= 108100
 
-              std::vector<std::pair<Point<spacedim>, unsigned int>>
-                closest_vertex_in_domain;
-              triangulation_cache->get_used_vertices_rtree().query(
-                boost::geometry::index::nearest(out_particle->get_location(),
-                                                1),
-                std::back_inserter(closest_vertex_in_domain));
-
-              // We should have one and only one result
-              AssertDimension(closest_vertex_in_domain.size(), 1);
-              const unsigned int closest_vertex_index_in_domain =
-                closest_vertex_in_domain[0].second;
+                  std::vector<std::pair<Point<spacedim>, unsigned int>>
+                    closest_vertex_in_domain;
+                  triangulation_cache->get_used_vertices_rtree().query(
+                    boost::geometry::index::nearest(
+                      out_particle->get_location(), 1),
+                    std::back_inserter(closest_vertex_in_domain));
+
+                  // We should have one and only one result
+                  AssertDimension(closest_vertex_in_domain.size(), 1);
+                  const unsigned int closest_vertex_index_in_domain =
+                    closest_vertex_in_domain[0].second;
 #else
-              const unsigned int closest_vertex_index_in_domain =
-                GridTools::find_closest_vertex(*mapping,
-                                               *triangulation,
-                                               out_particle->get_location());
+                  const unsigned int closest_vertex_index_in_domain =
+                    GridTools::find_closest_vertex(
+                      *mapping, *triangulation, out_particle->get_location());
 #endif
 
-              // Search all of the cells adjacent to the closest vertex of the
-              // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
-                {
-                  mapping->transform_points_real_to_unit_cell(
-                    cell, real_locations, reference_locations);
-
-                  if (GeometryInfo<dim>::is_inside_unit_cell(
-                        reference_locations[0], tolerance_inside_cell))
+                  // Search all of the cells adjacent to the closest vertex of
+                  // the domain. Most likely we will find the particle in them.
+                  for (const auto &cell :
+                       vertex_to_cells[closest_vertex_index_in_domain])
                     {
-                      current_cell = cell;
-                      found_cell   = true;
-                      break;
+                      mapping->transform_points_real_to_unit_cell(
+                        cell, real_locations, reference_locations);
+
+                      if (GeometryInfo<dim>::is_inside_unit_cell(
+                            reference_locations[0], tolerance_inside_cell))
+                        {
+                          current_cell = cell;
+                          found_cell   = true;
+                          break;
+                        }
                     }
                 }
+
+              if (found_cell)
+                {
+                  new_cells[p]               = current_cell;
+                  new_reference_locations[p] = reference_locations[0];
+                }
             }
+        },
+        /* grainsize = */ 64);
 
-          if (!found_cell)
+      for (unsigned int p = 0; p < n_particles_out_of_cell; ++p)
+        {
+          particle_iterator &out_particle = particles_out_of_cell[p];
+          const auto        &current_cell = new_cells[p];
+
+          if (current_cell.state() != IteratorState::valid)
             {
               // We can find no cell for this particle. It has left the
               // domain due to an integration error or an open boundary.
@@ -1469,7 +1557,7 @@ namespace Particles
 
           // If we are here, we found a cell and reference position for this
           // particle
-          out_particle->set_reference_location(reference_locations[0]);
+          out_particle->set_reference_location(new_reference_locations[p]);
 
           // Reinsert the particle into our domain if we own its cell.
           // Mark it for MPI transfer otherwise
@@ -1507,10 +1595,19 @@ namespace Particles
       }
 #endif
 
-    // remove_particles also calls update_cached_numbers()
-    remove_particles(particles_out_of_cell);
+    // remove_particles_without_compaction also calls update_cached_numbers()
+    remove_particles_without_compaction(particles_out_of_cell);
 
     // now make sure particle data is sorted in order of iteration
+    compact_particle_storage();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::compact_particle_storage()
+  {
     std::vector<typename PropertyPool<dim, spacedim>::Handle> unsorted_handles;
     unsorted_handles.reserve(property_pool->n_registered_slots());
 
@@ -1524,7 +1621,68 @@ namespace Particles
 
     property_pool->sort_memory_slots(unsorted_handles);
 
-  } // namespace Particles
+    n_unsorted_storage_modifications = 0;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::set_storage_compaction_threshold(
+    const double threshold)
+  {
+    Assert(threshold >= 0,
+           ExcMessage("The storage compaction threshold must not be "
+                      "negative."));
+    storage_compaction_threshold = threshold;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::compact_particle_storage_if_fragmented()
+  {
+    const types::particle_index n_stored_particles =
+      property_pool->n_registered_slots();
+
+    if (n_stored_particles == 0 || n_unsorted_storage_modifications == 0 ||
+        n_unsorted_storage_modifications <=
+          storage_compaction_threshold * n_stored_particles)
+      return;
+
+    // Count the particles whose slot does not directly follow the slot of
+    // the previous particle in the order of iteration
+    typename PropertyPool<dim, spacedim>::Handle expected_handle = 0;
+
+    types::particle_index n_particles_in_container = 0;
+    types::particle_index n_out_of_order           = 0;
+    for (const auto &particles_in_cell : particles)
+      for (const auto &particle : particles_in_cell.particles)
+        {
+          if (particle != expected_handle)
+            ++n_out_of_order;
+          expected_handle = particle + 1;
+          ++n_particles_in_container;
+        }
+
+    // Particle objects outside of this class may hold slots of the property
+    // pool (see Particle::set_property_pool()). We can not renumber their
+    // handles, so leave the storage alone in that case.
+    if (n_particles_in_container != n_stored_particles)
+      return;
+
+    const types::particle_index n_unused_slots =
+      property_pool->n_slots() - n_stored_particles;
+    const double fragmentation =
+      static_cast<double>(n_out_of_order + n_unused_slots) /
+      property_pool->n_slots();
+
+    if (fragmentation > storage_compaction_threshold)
+      compact_particle_storage();
+    else
+      n_unsorted_storage_modifications = 0;
+  }
 
 
 
@@ -1561,6 +1719,9 @@ namespace Particles
           for (auto &ghost_particle :
                cells_to_particle_cache[cell->active_cell_index()]->particles)
             property_pool->deregister_particle(ghost_particle);
+          n_unsorted_storage_modifications +=
+            cells_to_particle_cache[cell->active_cell_index()]
+              ->particles.size();
 
           // Clear particles themselves
           particles.erase(cells_to_particle_cache[cell->active_cell_index()]);
@@ -1632,6 +1793,8 @@ namespace Particles
         std::vector<
           typename Triangulation<dim, spacedim>::active_cell_iterator>>(),
       enable_cache);
+
+    compact_particle_storage_if_fragmented();
 #endif
   }
 
@@ -2252,6 +2415,7 @@ namespace Particles
         // Reset handle and update global numbers.
         tria_attached_data_index = numbers::invalid_unsigned_int;
         update_cached_numbers();
+        compact_particle_storage_if_fragmented();
       }
   }
 
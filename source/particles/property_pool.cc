@@ -13,10 +13,13 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <deal.II/particles/property_pool.h>
 
+#include <cstring>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
@@ -71,6 +74,15 @@ namespace Particles
     properties.clear();
     properties.shrink_to_fit();
 
+    // Keep the property columns themselves, but release their values
+    for (auto &column : property_columns)
+      std::visit(
+        [](auto &values) {
+          values.clear();
+          values.shrink_to_fit();
+        },
+        column);
+
     currently_available_handles.clear();
     currently_available_handles.shrink_to_fit();
   }
@@ -95,6 +107,9 @@ namespace Particles
         reference_locations.resize(reference_locations.size() + 1);
         ids.resize(ids.size() + 1);
         properties.resize(properties.size() + n_properties);
+        for (auto &column : property_columns)
+          std::visit([](auto &values) { values.resize(values.size() + 1); },
+                     column);
       }
 
     // Then initialize whatever slot we have taken with invalid locations,
@@ -104,6 +119,8 @@ namespace Particles
     set_id(handle, numbers::invalid_unsigned_int);
     for (double &x : get_properties(handle))
       x = 0;
+    for (auto &column : property_columns)
+      std::visit([handle](auto &values) { values[handle] = 0; }, column);
 
     return handle;
   }
@@ -139,6 +156,8 @@ namespace Particles
         locations.clear();
         reference_locations.clear();
         ids.clear();
+        for (auto &column : property_columns)
+          std::visit([](auto &values) { values.clear(); }, column);
       }
   }
 
@@ -152,6 +171,8 @@ namespace Particles
     reference_locations.reserve(size);
     properties.reserve(size * n_properties);
     ids.reserve(size);
+    for (auto &column : property_columns)
+      std::visit([size](auto &values) { values.reserve(size); }, column);
   }
 
 
@@ -181,6 +202,15 @@ namespace Particles
            ExcMessage("Number of registered locations is not equal to number "
                       "of registered property slots."));
 
+    for (const auto &column : property_columns)
+      {
+        (void)column;
+        Assert(std::visit([](const auto &values) { return values.size(); },
+                          column) == locations.size(),
+               ExcMessage("Number of registered locations is not equal to "
+                          "number of entries in a property column."));
+      }
+
     return locations.size() - currently_available_handles.size();
   }
 
@@ -191,47 +221,137 @@ namespace Particles
   PropertyPool<dim, spacedim>::sort_memory_slots(
     const std::vector<Handle> &handles_to_sort)
   {
-    std::vector<Point<spacedim>>       sorted_locations;
-    std::vector<Point<dim>>            sorted_reference_locations;
-    std::vector<types::particle_index> sorted_ids;
-    std::vector<double>                sorted_properties;
-
-    sorted_locations.reserve(locations.size());
-    sorted_reference_locations.reserve(reference_locations.size());
-    sorted_ids.reserve(ids.size());
-    sorted_properties.reserve(properties.size());
-
-    for (const auto &handle : handles_to_sort)
-      {
-        Assert(handle != invalid_handle,
-               ExcMessage(
-                 "Invalid handle detected during sorting particle memory."));
+    const std::size_t n_sorted = handles_to_sort.size();
 
-        sorted_locations.push_back(locations[handle]);
-        sorted_reference_locations.push_back(reference_locations[handle]);
-        sorted_ids.push_back(ids[handle]);
-
-        for (unsigned int j = 0; j < n_properties; ++j)
-          sorted_properties.push_back(properties[handle * n_properties + j]);
-      }
-
-    Assert(sorted_locations.size() ==
-             locations.size() - currently_available_handles.size(),
+    Assert(n_sorted == locations.size() - currently_available_handles.size(),
            ExcMessage("Number of sorted property handles is not equal to "
                       "number of currently registered handles: " +
-                      std::to_string(sorted_locations.size()) + " vs " +
+                      std::to_string(n_sorted) + " vs " +
                       std::to_string(locations.size()) + " - " +
                       std::to_string(currently_available_handles.size())));
 
+    // The permutation is a pure gather operation, so every entry of the new
+    // arrays can be filled independently. Split the work into chunks that
+    // are large enough to amortize the cost of spawning tasks.
+    const unsigned int grain_size = 4096;
+
+    std::vector<Point<spacedim>>       sorted_locations(n_sorted);
+    std::vector<Point<dim>>            sorted_reference_locations(n_sorted);
+    std::vector<types::particle_index> sorted_ids(n_sorted);
+    std::vector<double> sorted_properties(n_sorted * n_properties);
+
+    parallel::apply_to_subranges(
+      std::size_t(0),
+      n_sorted,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+          {
+            const Handle handle = handles_to_sort[i];
+            Assert(handle != invalid_handle,
+                   ExcMessage("Invalid handle detected during sorting "
+                              "particle memory."));
+
+            sorted_locations[i]           = locations[handle];
+            sorted_reference_locations[i] = reference_locations[handle];
+            sorted_ids[i]                 = ids[handle];
+
+            for (unsigned int j = 0; j < n_properties; ++j)
+              sorted_properties[i * n_properties + j] =
+                properties[handle * n_properties + j];
+          }
+      },
+      grain_size);
+
     locations           = std::move(sorted_locations);
     reference_locations = std::move(sorted_reference_locations);
     ids                 = std::move(sorted_ids);
     properties          = std::move(sorted_properties);
 
+    for (auto &column : property_columns)
+      std::visit(
+        [&](auto &values) {
+          std::remove_reference_t<decltype(values)> sorted_values(n_sorted);
+          parallel::apply_to_subranges(
+            std::size_t(0),
+            n_sorted,
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t i = begin; i < end; ++i)
+                sorted_values[i] = values[handles_to_sort[i]];
+            },
+            grain_size);
+          values = std::move(sorted_values);
+        },
+        column);
+
     currently_available_handles.clear();
   }
 
 
+
+  template <int dim, int spacedim>
+  std::size_t
+  PropertyPool<dim, spacedim>::property_columns_size_in_bytes() const
+  {
+    std::size_t size = 0;
+    for (const auto &column : property_columns)
+      size += std::visit(
+        [](const auto &values) {
+          return sizeof(typename std::decay_t<decltype(values)>::value_type);
+        },
+        column);
+
+    // Round up to keep subsequent data aligned
+    return (size + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void *
+  PropertyPool<dim, spacedim>::write_property_columns_to_memory(
+    const Handle handle,
+    void        *data) const
+  {
+    char *begin = static_cast<char *>(data);
+    char *out   = begin;
+    for (const auto &column : property_columns)
+      std::visit(
+        [handle, &out](const auto &values) {
+          AssertIndexRange(handle, values.size());
+          std::memcpy(out, &values[handle], sizeof(values[handle]));
+          out += sizeof(values[handle]);
+        },
+        column);
+
+    const std::size_t padded_size = property_columns_size_in_bytes();
+    std::memset(out, 0, padded_size - (out - begin));
+
+    return begin + padded_size;
+  }
+
+
+
+  template <int dim, int spacedim>
+  const void *
+  PropertyPool<dim, spacedim>::read_property_columns_from_memory(
+    const Handle handle,
+    const void  *data)
+  {
+    const char *begin = static_cast<const char *>(data);
+    const char *in    = begin;
+    for (auto &column : property_columns)
+      std::visit(
+        [handle, &in](auto &values) {
+          AssertIndexRange(handle, values.size());
+          std::memcpy(&values[handle], in, sizeof(values[handle]));
+          in += sizeof(values[handle]);
+        },
+        column);
+
+    return begin + property_columns_size_in_bytes();
+  }
+
+
   // Instantiate the class for all reasonable template arguments
   template class PropertyPool<1, 1>;
   template class PropertyPool<1, 2>;
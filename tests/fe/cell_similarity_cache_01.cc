@@ -0,0 +1,153 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that FEValues::set_similarity_cache_size() gives the same values,
+// gradients, quadrature points, and JxW values as an FEValues object without
+// cache, when visiting the cells of a locally refined mesh in an order in
+// which consecutive cells are usually not translations of each other. also
+// check distorted cells and a higher order mapping, for which the cache must
+// not return data of other cells. finally check that the cache is used: the
+// undistorted meshes only have two classes of translated cells, so the cache
+// must only store two cells although most cells visited are no translations
+// of the previous one, and its size must not exceed the given bound
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const Mapping<dim>       &mapping,
+     const FiniteElement<dim> &fe,
+     const bool                distort)
+{
+  Triangulation<dim> tria;
+  GridGenerator::subdivided_hyper_rectangle(
+    tria,
+    std::vector<unsigned int>(dim, 2),
+    Point<dim>(),
+    dim == 2 ? Point<dim>(2, 1) : Point<dim>(2, 1, 1));
+  tria.refine_global(1);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+  if (distort)
+    GridTools::distort_random(0.1, tria, true, 42);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  // visit the cells alternately from the front and from the back
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cells.push_back(cell);
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> order;
+  for (unsigned int i = 0; i < cells.size(); ++i)
+    order.push_back(i % 2 == 0 ? cells[i / 2] :
+                                 cells[cells.size() - 1 - i / 2]);
+
+  const QGauss<dim> quadrature(fe.degree + 1);
+  const UpdateFlags flags = update_values | update_gradients |
+                            update_quadrature_points | update_JxW_values;
+  FEValues<dim> fe_values(mapping, fe, quadrature, flags);
+  FEValues<dim> fe_values_cached(mapping, fe, quadrature, flags);
+  // the cache is only used if cell similarity checks are allowed, which
+  // is not the case by default if the test runs with several threads
+  fe_values_cached.always_allow_check_for_cell_similarity(true);
+  fe_values_cached.set_similarity_cache_size(4);
+
+  // the memory of one entry of the cache, determined after the first cell
+  std::size_t memory_per_entry = 0;
+
+  double error = 0;
+  for (unsigned int round = 0; round < 2; ++round)
+    for (const auto &cell : order)
+      {
+        fe_values.reinit(cell);
+        fe_values_cached.reinit(cell);
+
+        if (memory_per_entry == 0)
+          memory_per_entry = fe_values_cached.memory_consumption() -
+                             fe_values.memory_consumption();
+
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          {
+            error += std::abs(fe_values.JxW(q) - fe_values_cached.JxW(q));
+            error += fe_values.quadrature_point(q).distance(
+              fe_values_cached.quadrature_point(q));
+            for (const unsigned int i : fe_values.dof_indices())
+              for (unsigned int c = 0; c < fe.n_components(); ++c)
+                {
+                  error += std::abs(fe_values.shape_value_component(i, q, c) -
+                                    fe_values_cached.shape_value_component(i,
+                                                                           q,
+                                                                           c));
+                  error += (fe_values.shape_grad_component(i, q, c) -
+                            fe_values_cached.shape_grad_component(i, q, c))
+                             .norm();
+                }
+          }
+      }
+
+  const std::size_t memory_of_cache =
+    fe_values_cached.memory_consumption() - fe_values.memory_consumption();
+
+  deallog << fe.get_name() << (distort ? ", distorted" : "") << ": "
+          << (error < 1e-10 ? "OK" : "Failed") << ", cached cells: "
+          << (memory_per_entry > 0 ? memory_of_cache / memory_per_entry : 0)
+          << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const MappingQ<dim>         mapping_q1(1);
+  const MappingQ<dim>         mapping_q2(2);
+  const MappingCartesian<dim> mapping_cartesian;
+
+  test(mapping_q1, FE_Q<dim>(2), false);
+  test(mapping_q1, FESystem<dim>(FE_Q<dim>(2), dim, FE_DGQ<dim>(1), 1), false);
+  test(mapping_q1, FE_Q<dim>(2), true);
+  test(mapping_q2, FE_Q<dim>(2), false);
+  test(mapping_cartesian, FE_DGQ<dim>(3), false);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,121 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that FEValuesBatch computes the same shape values, gradients,
+// quadrature points, and JxW values on each lane as FEValues on the
+// respective cell, including a last batch with fewer cells than lanes
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/fe_values_batch.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim, typename Number>
+void
+test(const Mapping<dim> &mapping, const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  GridTools::distort_random(0.1, tria, true, 42);
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> cells;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cells.push_back(cell);
+
+  const QGauss<dim> quadrature(fe.degree + 1);
+  const UpdateFlags flags = update_values | update_gradients |
+                            update_quadrature_points | update_JxW_values;
+  FEValues<dim>              fe_values(mapping, fe, quadrature, flags);
+  FEValuesBatch<dim, Number> fe_values_batch(mapping, fe, quadrature, flags);
+
+  const unsigned int n_lanes = FEValuesBatch<dim, Number>::n_lanes;
+  double             error   = 0;
+  for (unsigned int c = 0; c < cells.size(); c += n_lanes)
+    {
+      const unsigned int n_cells =
+        std::min<unsigned int>(n_lanes, cells.size() - c);
+      fe_values_batch.reinit(make_array_view(std::as_const(cells), c, n_cells));
+      AssertDimension(fe_values_batch.n_active_lanes(), n_cells);
+
+      for (unsigned int v = 0; v < n_cells; ++v)
+        {
+          fe_values.reinit(cells[c + v]);
+          for (const unsigned int q : fe_values.quadrature_point_indices())
+            {
+              const double JxW = fe_values.JxW(q);
+              error += std::abs(JxW - fe_values_batch.JxW(q)[v]) / JxW;
+              for (unsigned int d = 0; d < dim; ++d)
+                error += std::abs(fe_values.quadrature_point(q)[d] -
+                                  fe_values_batch.quadrature_point(q)[d][v]);
+              for (const unsigned int i : fe_values.dof_indices())
+                {
+                  error += std::abs(fe_values.shape_value(i, q) -
+                                    fe_values_batch.shape_value(i, q)[v]);
+                  for (unsigned int d = 0; d < dim; ++d)
+                    error += std::abs(fe_values.shape_grad(i, q)[d] -
+                                      fe_values_batch.shape_grad(i, q)[d][v]);
+                }
+            }
+        }
+    }
+
+  const double tolerance =
+    100. * std::numeric_limits<Number>::epsilon() * cells.size() *
+    quadrature.size() * fe.n_dofs_per_cell();
+  deallog << fe.get_name() << ", " << Utilities::type_to_string(Number())
+          << ": " << (error < tolerance ? "OK" : "Failed") << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  const MappingQ<dim> mapping(2);
+  test<dim, double>(mapping, FE_Q<dim>(2));
+  test<dim, double>(mapping,
+                    FESystem<dim>(FE_Q<dim>(2), dim, FE_DGQ<dim>(1), 1));
+  test<dim, float>(mapping, FE_Q<dim>(3));
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
@@ -0,0 +1,72 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that FEValuesBatch rejects elements that rescale their shape
+// functions by the cell size, like FE_Hermite, also inside an FESystem, and
+// accepts FE_Q
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_hermite.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values_batch.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  const MappingQ<dim> mapping(1);
+  const QGauss<dim>   quadrature(fe.degree + 1);
+  try
+    {
+      FEValuesBatch<dim> fe_values_batch(mapping,
+                                         fe,
+                                         quadrature,
+                                         update_values | update_gradients);
+      deallog << fe.get_name() << ": accepted" << std::endl;
+    }
+  catch (const ExceptionBase &)
+    {
+      deallog << fe.get_name() << ": rejected" << std::endl;
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  test<dim>(FE_Q<dim>(2));
+  test<dim>(FE_Hermite<dim>(3));
+  test<dim>(FESystem<dim>(FE_Q<dim>(2), 1, FE_Hermite<dim>(3), 1));
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>();
+  test<3>();
+}
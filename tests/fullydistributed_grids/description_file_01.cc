@@ -0,0 +1,100 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Write the descriptions of all partitions of a serial triangulation to a
+// file with TriangulationDescription::Utilities::write_descriptions() and
+// check that reading single partitions back gives the same descriptions as
+// creating them directly.
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const unsigned int n_partitions = 4;
+
+  Triangulation<dim> basetria;
+  GridGenerator::hyper_L(basetria);
+  basetria.refine_global(2);
+  GridTools::partition_triangulation_zorder(n_partitions, basetria);
+
+  const std::string filename = "mesh_" + std::to_string(dim) + "d.pft";
+  TriangulationDescription::Utilities::write_descriptions(basetria,
+                                                          n_partitions,
+                                                          filename);
+
+  // read the partitions in reverse order to make sure that the index is
+  // used rather than reading the file sequentially
+  for (unsigned int p = n_partitions; p-- > 0;)
+    {
+      const auto description =
+        TriangulationDescription::Utilities::load_description<dim, dim>(
+          filename, MPI_COMM_SELF, p);
+      const auto reference = TriangulationDescription::Utilities::
+        create_description_from_triangulation(
+          basetria,
+          MPI_COMM_SELF,
+          TriangulationDescription::Settings::default_setting,
+          p);
+      AssertThrow(description == reference, ExcInternalError());
+      deallog << "Partition " << p << " OK" << std::endl;
+    }
+
+  // a file with a single partition can be used to set up a fully
+  // distributed triangulation on a single process
+  GridTools::partition_triangulation_zorder(1, basetria);
+  TriangulationDescription::Utilities::write_descriptions(basetria,
+                                                          1,
+                                                          filename);
+
+  parallel::fullydistributed::Triangulation<dim> tria_pft(comm);
+  tria_pft.create_triangulation(
+    TriangulationDescription::Utilities::load_description<dim, dim>(filename,
+                                                                    comm));
+  deallog << "Cells: " << tria_pft.n_global_active_cells() << std::endl;
+
+  std::remove(filename.c_str());
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  initlog();
+
+  {
+    deallog.push("2d");
+    test<2>(MPI_COMM_WORLD);
+    deallog.pop();
+  }
+  {
+    deallog.push("3d");
+    test<3>(MPI_COMM_WORLD);
+    deallog.pop();
+  }
+}
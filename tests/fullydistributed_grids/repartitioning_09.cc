@@ -0,0 +1,88 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test RepartitioningPolicyTools::SpaceFillingCurvePolicy: start from a
+// fully distributed triangulation with a poor (round-robin) partitioning and
+// repartition it along a Hilbert curve. Every process should get the same
+// number of cells, and the cells of each process should fill a compact
+// region of the domain.
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  const unsigned int n_procs = Utilities::MPI::n_mpi_processes(comm);
+
+  Triangulation<dim> basetria;
+  GridGenerator::hyper_cube(basetria);
+  basetria.refine_global(dim == 2 ? 3 : 2);
+
+  unsigned int counter = 0;
+  for (const auto &cell : basetria.active_cell_iterators())
+    cell->set_subdomain_id(counter++ % n_procs);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      basetria, comm));
+
+  const RepartitioningPolicyTools::SpaceFillingCurvePolicy<dim> policy;
+  tria.set_partitioner(policy,
+                       TriangulationDescription::Settings::default_setting);
+  tria.repartition();
+
+  BoundingBox<dim> box;
+  bool             first = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->is_locally_owned())
+      {
+        if (first)
+          box = cell->bounding_box();
+        else
+          box.merge_with(cell->bounding_box());
+        first = false;
+      }
+
+  deallog << "n_locally_owned_active_cells: "
+          << tria.n_locally_owned_active_cells() << std::endl;
+  deallog << "measure of bounding box: " << box.volume() << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>(MPI_COMM_WORLD);
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>(MPI_COMM_WORLD);
+  deallog.pop();
+}
@@ -0,0 +1,82 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test RepartitioningPolicyTools::MeasuredCostPolicy: the cells in the left
+// half of the domain are three times as expensive as the others, and all of
+// them are initially owned by the first process. The policy should move
+// cells to the second process once, and then keep the partition since the
+// remaining imbalance is below the threshold.
+
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/distributed/repartitioning_policy_tools.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const MPI_Comm comm)
+{
+  Triangulation<dim> basetria;
+  GridGenerator::hyper_cube(basetria);
+  basetria.refine_global(3);
+
+  for (const auto &cell : basetria.active_cell_iterators())
+    cell->set_subdomain_id(cell->center()[0] < 0.5 ? 0 : 1);
+
+  parallel::fullydistributed::Triangulation<dim> tria(comm);
+  tria.create_triangulation(
+    TriangulationDescription::Utilities::create_description_from_triangulation(
+      basetria, comm));
+
+  RepartitioningPolicyTools::MeasuredCostPolicy<dim> policy(1.1, 0.05, 0.5);
+  tria.set_partitioner(policy,
+                       TriangulationDescription::Settings::default_setting);
+
+  unsigned int n_repartitions = 0;
+  tria.signals.post_distributed_repartition.connect(
+    [&n_repartitions]() { ++n_repartitions; });
+
+  for (unsigned int step = 0; step < 2; ++step)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_locally_owned())
+          policy.add_cell_cost(cell->id(), cell->center()[0] < 0.5 ? 3. : 1.);
+
+      tria.repartition();
+
+      deallog << "imbalance: " << policy.get_imbalance() << std::endl;
+      deallog << "n_locally_owned_active_cells: "
+              << tria.n_locally_owned_active_cells() << std::endl;
+      deallog << "n_repartitions: " << n_repartitions << std::endl;
+    }
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>(MPI_COMM_WORLD);
+  deallog.pop();
+}
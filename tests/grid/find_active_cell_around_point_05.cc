@@ -0,0 +1,80 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that GridTools::find_active_cell_around_point() finds a cell with
+// the help of the bounding volume hierarchy if the search around the
+// closest vertex fails, and that the hierarchy is only requested in that
+// case. The mesh consists of a long cell and a small disconnected cell
+// just above it, whose vertices are closer to the center of the long cell
+// than the vertices of the long cell itself.
+
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+int
+main()
+{
+  initlog();
+
+  const std::vector<Point<2>> vertices = {{0., 0.},
+                                          {10., 0.},
+                                          {0., 1.},
+                                          {10., 1.},
+                                          {4.9, 1.01},
+                                          {5.1, 1.01},
+                                          {4.9, 1.2},
+                                          {5.1, 1.2}};
+  std::vector<CellData<2>>    cells(2);
+  cells[0].vertices = {0, 1, 2, 3};
+  cells[1].vertices = {4, 5, 6, 7};
+
+  Triangulation<2> tria;
+  tria.create_triangulation(vertices, cells, SubCellData());
+
+  const GridTools::Cache<2> cache(tria);
+
+  unsigned int n_requests = 0;
+  const auto   get_bvh    = [&]() -> const auto & {
+    ++n_requests;
+    return cache.get_cell_bounding_boxes_bvh();
+  };
+
+  for (const Point<2> &p : {Point<2>(5., 1.105), Point<2>(5., 0.5)})
+    {
+      const auto cell_and_point =
+        GridTools::find_active_cell_around_point<2, Triangulation, 2>(
+          cache.get_mapping(),
+          tria,
+          p,
+          cache.get_vertex_to_cell_map(),
+          cache.get_vertex_to_cell_centers_directions(),
+          {},
+          {},
+          cache.get_used_vertices_rtree(),
+          1e-10,
+          nullptr,
+          get_bvh);
+
+      deallog << "Point " << p << ": cell " << cell_and_point.first->index()
+              << ", reference point " << cell_and_point.second
+              << ", hierarchy requested " << n_requests << " times"
+              << std::endl;
+    }
+}
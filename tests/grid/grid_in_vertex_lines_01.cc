@@ -0,0 +1,84 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that GridIn::read_msh() and GridIn::read_ucd(), which convert the
+// vertex coordinates to numbers in parallel, read vertices with unusual
+// whitespace, vertices broken across lines, and several vertices on one
+// line correctly
+
+#include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+void
+print(const Triangulation<2> &tria)
+{
+  for (const Point<2> &vertex : tria.get_vertices())
+    deallog << "Vertex " << vertex << std::endl;
+  deallog << "Cells: " << tria.n_active_cells()
+          << ", measure: " << tria.begin_active()->measure() << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  {
+    std::istringstream in("$MeshFormat\n"
+                          "2.2 0 8\n"
+                          "$EndMeshFormat\n"
+                          "$Nodes\n"
+                          "4\n"
+                          "1 0 0 0\n"
+                          "2\t2.0   0 0\n"
+                          "  3 2 1.5e0\n"
+                          "0 4 0 1.5 0\n"
+                          "$EndNodes\n"
+                          "$Elements\n"
+                          "1\n"
+                          "1 3 2 0 1 1 2 3 4\n"
+                          "$EndElements\n");
+
+    Triangulation<2> tria;
+    GridIn<2>        grid_in;
+    grid_in.attach_triangulation(tria);
+    grid_in.read_msh(in);
+    deallog << "msh" << std::endl;
+    print(tria);
+  }
+
+  {
+    std::istringstream in("# a comment\n"
+                          "4 1 0 0 0\n"
+                          "1 0 0 0\n"
+                          "2 2.0\t0 0\n"
+                          "3   2\n"
+                          "1.5 0 4 0 1.5e0 0\n"
+                          "1 0 quad 1 2 3 4\n");
+
+    Triangulation<2> tria;
+    GridIn<2>        grid_in;
+    grid_in.attach_triangulation(tria);
+    grid_in.read_ucd(in);
+    deallog << "ucd" << std::endl;
+    print(tria);
+  }
+}
@@ -0,0 +1,111 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// test that the data structures of GridTools::Cache that are updated
+// incrementally during local refinement and coarsening agree with the ones
+// computed from scratch
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/grid_tools_cache.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+check(const Triangulation<dim> &tria, const GridTools::Cache<dim> &cache)
+{
+  AssertThrow(cache.get_vertex_to_cell_map() ==
+                GridTools::vertex_to_cell_map(tria),
+              ExcInternalError());
+  AssertThrow(cache.get_vertex_to_cell_centers_directions() ==
+                GridTools::vertex_to_cell_centers_directions(
+                  tria, GridTools::vertex_to_cell_map(tria)),
+              ExcInternalError());
+  AssertThrow(cache.get_used_vertices() ==
+                GridTools::extract_used_vertices(tria, cache.get_mapping()),
+              ExcInternalError());
+
+  const auto &vertex_tree = cache.get_used_vertices_rtree();
+  AssertThrow(vertex_tree.size() == cache.get_used_vertices().size(),
+              ExcInternalError());
+  for (const auto &[index, point] : cache.get_used_vertices())
+    AssertThrow(vertex_tree.count(std::make_pair(point, index)) == 1,
+                ExcInternalError());
+
+  const auto &cell_tree  = cache.get_cell_bounding_boxes_rtree();
+  const auto &owned_tree = cache.get_locally_owned_cell_bounding_boxes_rtree();
+  for (const auto *tree : {&cell_tree, &owned_tree})
+    {
+      AssertThrow(tree->size() == tria.n_active_cells(), ExcInternalError());
+      for (const auto &cell : tria.active_cell_iterators())
+        AssertThrow(tree->count(std::make_pair(
+                      cache.get_mapping().get_bounding_box(cell), cell)) == 1,
+                    ExcInternalError());
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  GridTools::Cache<dim> cache(tria);
+  check(tria, cache);
+
+  Point<dim> center;
+  for (unsigned int cycle = 0; cycle < 4; ++cycle)
+    {
+      // move a refined region through the domain, so that cells are both
+      // refined and coarsened in each cycle
+      for (unsigned int d = 0; d < dim; ++d)
+        center[d] = 0.2 + 0.2 * cycle;
+
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->center().distance(center) < 0.25 && cell->level() < 4)
+          cell->set_refine_flag();
+        else if (cell->level() > 2)
+          cell->set_coarsen_flag();
+      tria.execute_coarsening_and_refinement();
+
+      check(tria, cache);
+      deallog << "Cycle " << cycle << ": OK" << std::endl;
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
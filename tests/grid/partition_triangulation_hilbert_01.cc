@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test GridTools::partition_triangulation_hilbert: every partition should get
+// the same number of cells and fill a compact part of the domain, and the
+// result should not depend on the number of threads. Also check that an
+// empty triangulation is accepted.
+
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const unsigned int n_refinements, const unsigned int n_partitions)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_refinements);
+
+  GridTools::partition_triangulation_hilbert(n_partitions, tria);
+
+  std::vector<types::subdomain_id> subdomain_ids;
+  for (const auto &cell : tria.active_cell_iterators())
+    subdomain_ids.push_back(cell->subdomain_id());
+
+  for (unsigned int p = 0; p < n_partitions; ++p)
+    {
+      unsigned int     n_cells = 0;
+      BoundingBox<dim> box;
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->subdomain_id() == p)
+          {
+            if (n_cells == 0)
+              box = cell->bounding_box();
+            else
+              box.merge_with(cell->bounding_box());
+            ++n_cells;
+          }
+      deallog << "Partition " << p << ": " << n_cells
+              << " cells, measure of bounding box " << box.volume()
+              << std::endl;
+    }
+
+  // partition again with a single thread
+  const unsigned int n_threads = MultithreadInfo::n_threads();
+  MultithreadInfo::set_thread_limit(1);
+  GridTools::partition_triangulation_hilbert(n_partitions, tria);
+  MultithreadInfo::set_thread_limit(n_threads);
+
+  bool same = true;
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->subdomain_id() != subdomain_ids[cell->active_cell_index()])
+      same = false;
+  deallog << "Same partition with one thread: " << same << std::endl;
+}
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>(3, 4);
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>(2, 4);
+  deallog.pop();
+
+  {
+    Triangulation<2> tria;
+    GridTools::partition_triangulation_hilbert(4, tria);
+    deallog << "Empty triangulation: OK" << std::endl;
+  }
+}
@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that the new vertices created during isotropic refinement, which are
+// computed in parallel before the children are created, coincide with the
+// centers of the refined lines, faces and cells as given by the manifold
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+  for (const auto &cell : tria.active_cell_iterators())
+    if (cell->center()[0] > 0)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  double max_distance_lines = 0;
+  double max_distance_faces = 0;
+  double max_distance_cells = 0;
+  for (const auto &cell : tria.cell_iterators())
+    if (cell->has_children())
+      {
+        for (const unsigned int l : cell->line_indices())
+          max_distance_lines = std::max(
+            max_distance_lines,
+            cell->line(l)->child(0)->vertex(1).distance(
+              cell->line(l)->center(true)));
+
+        if (dim == 3)
+          for (const unsigned int f : cell->face_indices())
+            max_distance_faces = std::max(
+              max_distance_faces,
+              cell->face(f)->child(0)->vertex(3).distance(
+                cell->face(f)->center(true, true)));
+
+        // the vertex in the center of the cell is the last vertex of the
+        // first child
+        max_distance_cells = std::max(
+          max_distance_cells,
+          cell->child(0)->vertex(cell->n_vertices() - 1).distance(
+            cell->center(true, true)));
+      }
+
+  deallog << "Lines: " << (max_distance_lines < 1e-12 ? "OK" : "Failed")
+          << std::endl;
+  if (dim == 3)
+    deallog << "Faces: " << (max_distance_faces < 1e-12 ? "OK" : "Failed")
+            << std::endl;
+  deallog << "Cells: " << (max_distance_cells < 1e-12 ? "OK" : "Failed")
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(4);
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,114 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Check that the storage of user indices is only allocated upon the first
+// write access and not by reads, survives refinement, is released by
+// clear_user_data(), and can be allocated by concurrent first writes
+
+#include <deal.II/base/thread_management.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(2);
+
+  const std::size_t memory_without_user_data = tria.memory_consumption();
+  deallog << "User index before first write: " << tria.begin()->user_index()
+          << std::endl;
+
+  // neither reading nor clearing the user indices allocates the storage
+  unsigned int sum = 0;
+  for (const auto &cell : tria.cell_iterators())
+    {
+      sum += cell->user_index();
+      cell->clear_user_index();
+    }
+  deallog << "Memory unchanged by reading and clearing: "
+          << (sum == 0 && tria.memory_consumption() == memory_without_user_data)
+          << std::endl;
+
+  unsigned int index = 1;
+  for (const auto &cell : tria.active_cell_iterators())
+    cell->set_user_index(index++);
+  deallog << "Memory grows with user data: "
+          << (tria.memory_consumption() > memory_without_user_data)
+          << std::endl;
+
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  bool indices_preserved = true;
+  index                  = 1;
+  for (const auto &cell : tria.cell_iterators_on_level(2))
+    if (cell->user_index() != index++)
+      indices_preserved = false;
+  deallog << "User indices preserved by refinement: " << indices_preserved
+          << std::endl;
+  deallog << "User index of new child: "
+          << tria.begin_active(3)->user_index() << std::endl;
+
+  const std::size_t memory_with_user_data = tria.memory_consumption();
+  tria.clear_user_data();
+  deallog << "Memory released by clear_user_data(): "
+          << (tria.memory_consumption() < memory_with_user_data) << std::endl;
+  deallog << "User index after clear_user_data(): "
+          << tria.begin_active()->user_index() << std::endl;
+
+  // set the user indices from several tasks at once, starting from
+  // unallocated storage
+  std::vector<typename Triangulation<dim>::active_cell_iterator> cells;
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+  Threads::TaskGroup<void> tasks;
+  for (unsigned int t = 0; t < 4; ++t)
+    tasks += Threads::new_task([&cells, t]() {
+      for (unsigned int c = t; c < cells.size(); c += 4)
+        cells[c]->set_user_index(c + 1);
+    });
+  tasks.join_all();
+
+  bool indices_set = true;
+  for (unsigned int c = 0; c < cells.size(); ++c)
+    if (cells[c]->user_index() != c + 1)
+      indices_set = false;
+  deallog << "User indices set concurrently: " << indices_set << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,132 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Transfer several vectors at once with SolutionTransfer, with and without
+// hp-capabilities and with a change of the finite element on some cells
+// after refinement. All vectors are linear functions, which are represented
+// exactly by all elements, so the transferred vectors need to coincide with
+// the interpolation of the functions on the new mesh.
+
+
+#include <deal.II/base/function.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/solution_transfer.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const bool use_hp)
+{
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  hp::FECollection<dim> fe_collection;
+  fe_collection.push_back(FE_Q<dim>(2));
+  if (use_hp)
+    fe_collection.push_back(FE_Q<dim>(1));
+
+  DoFHandler<dim> dof_handler(triangulation);
+  if (use_hp)
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      cell->set_active_fe_index(cell->active_cell_index() % 2);
+  dof_handler.distribute_dofs(fe_collection);
+
+  const unsigned int                                     n_vectors = 5;
+  std::vector<std::function<double(const Point<dim> &)>> functions;
+  for (unsigned int j = 0; j < n_vectors; ++j)
+    functions.emplace_back([j](const Point<dim> &p) {
+      double value = j;
+      for (unsigned int d = 0; d < dim; ++d)
+        value += (d + 1.) * (j + 1.) * p[d];
+      return value;
+    });
+
+  std::vector<Vector<double>> old_vectors(n_vectors);
+  for (unsigned int j = 0; j < n_vectors; ++j)
+    {
+      old_vectors[j].reinit(dof_handler.n_dofs());
+      VectorTools::interpolate(
+        dof_handler,
+        ScalarFunctionFromFunctionObject<dim>(functions[j]),
+        old_vectors[j]);
+    }
+
+  const unsigned int n_cells = triangulation.n_active_cells();
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->active_cell_index() < n_cells / 4)
+      cell->set_coarsen_flag();
+    else if (cell->active_cell_index() >= 3 * n_cells / 4)
+      cell->set_refine_flag();
+  triangulation.prepare_coarsening_and_refinement();
+
+  SolutionTransfer<dim, Vector<double>> solution_transfer(dof_handler);
+  solution_transfer.prepare_for_coarsening_and_refinement(old_vectors);
+  triangulation.execute_coarsening_and_refinement();
+
+  if (use_hp)
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->active_cell_index() % 3 == 0)
+        cell->set_active_fe_index(1 - cell->active_fe_index());
+  dof_handler.distribute_dofs(fe_collection);
+
+  std::vector<Vector<double>> new_vectors(n_vectors,
+                                          Vector<double>(dof_handler.n_dofs()));
+  solution_transfer.interpolate(old_vectors, new_vectors);
+
+  Vector<double> interpolation(dof_handler.n_dofs());
+  for (unsigned int j = 0; j < n_vectors; ++j)
+    {
+      VectorTools::interpolate(
+        dof_handler,
+        ScalarFunctionFromFunctionObject<dim>(functions[j]),
+        interpolation);
+      new_vectors[j] -= interpolation;
+      AssertThrow(new_vectors[j].linfty_norm() <
+                    1e-12 * interpolation.linfty_norm(),
+                  ExcInternalError());
+    }
+
+  deallog << "dim=" << dim << (use_hp ? ", hp" : "") << ": OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(false);
+  test<2>(true);
+  test<3>(false);
+  test<3>(true);
+}
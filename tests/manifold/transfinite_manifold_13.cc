@@ -0,0 +1,156 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test that TransfiniteInterpolationManifold::get_new_points(), which
+// evaluates the transfinite interpolation for all new points at once, gives
+// the same result as calling get_new_point() for each new point, on meshes
+// with curved boundaries described by a SphericalManifold or a
+// CylindricalManifold
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+
+#include "../tests.h"
+
+
+template <int dim, int spacedim>
+void
+do_test(const Triangulation<dim, spacedim> &tria)
+{
+  // the weights of the vertices for the points of a Gauss formula
+  const QGauss<dim> quadrature(3);
+  Table<2, double>  weights(quadrature.size(),
+                            GeometryInfo<dim>::vertices_per_cell);
+  for (unsigned int q = 0; q < quadrature.size(); ++q)
+    for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+      {
+        weights(q, v) = 1.;
+        for (unsigned int d = 0; d < dim; ++d)
+          weights(q, v) *= (v & (1 << d)) ? quadrature.point(q)[d] :
+                                            1. - quadrature.point(q)[d];
+      }
+
+  double max_difference = 0.;
+  for (const auto &cell : tria.active_cell_iterators())
+    {
+      std::vector<Point<spacedim>> vertices;
+      for (const unsigned int v : cell->vertex_indices())
+        vertices.push_back(cell->vertex(v));
+
+      std::vector<Point<spacedim>> new_points(quadrature.size());
+      cell->get_manifold().get_new_points(make_array_view(vertices),
+                                          weights,
+                                          make_array_view(new_points));
+
+      for (unsigned int q = 0; q < quadrature.size(); ++q)
+        {
+          std::vector<double> weights_q(weights.size(1));
+          for (unsigned int v = 0; v < weights.size(1); ++v)
+            weights_q[v] = weights(q, v);
+          const Point<spacedim> reference =
+            cell->get_manifold().get_new_point(make_array_view(vertices),
+                                               make_array_view(weights_q));
+          max_difference =
+            std::max(max_difference, reference.distance(new_points[q]));
+        }
+    }
+
+  deallog << "n_active_cells " << tria.n_active_cells() << ": "
+          << (max_difference < 1e-12 ? "OK" : "FAILED") << std::endl;
+}
+
+
+
+template <int dim, int spacedim>
+void
+test_spherical()
+{
+  deallog << "Testing with SphericalManifold dim=" << dim
+          << ", spacedim=" << spacedim << std::endl;
+
+  SphericalManifold<dim, spacedim>                spherical_manifold;
+  TransfiniteInterpolationManifold<dim, spacedim> manifold;
+
+  Triangulation<dim, spacedim> tria;
+  GridGenerator::hyper_ball(tria);
+
+  // set all entities to the transfinite manifold except for the boundary
+  // where we put the spherical manifold
+  tria.set_all_manifold_ids(1);
+  tria.set_all_manifold_ids_on_boundary(0);
+  tria.set_manifold(0, spherical_manifold);
+  manifold.initialize(tria);
+  tria.set_manifold(1, manifold);
+
+  do_test(tria);
+  tria.refine_global(1);
+  do_test(tria);
+}
+
+
+
+void
+test_cylinder()
+{
+  const unsigned int dim = 3, spacedim = 3;
+  deallog << "Testing with CylindricalManifold in 3d" << std::endl;
+
+  CylindricalManifold<dim, spacedim>              cylinder_manifold;
+  TransfiniteInterpolationManifold<dim, spacedim> manifold;
+  Triangulation<dim, spacedim>                    tria;
+  GridGenerator::cylinder(tria);
+  tria.set_all_manifold_ids(1);
+
+  for (const auto &cell : tria.active_cell_iterators())
+    for (const unsigned int face : cell->face_indices())
+      if (cell->at_boundary(face))
+        {
+          bool cell_at_surfaces = true;
+          for (unsigned int i = 1; i < GeometryInfo<dim>::vertices_per_face;
+               ++i)
+            if (std::abs(cell->face(face)->vertex(i)[0] -
+                         cell->face(face)->vertex(0)[0]) > 1e-10)
+              cell_at_surfaces = false;
+          if (cell_at_surfaces == false)
+            cell->face(face)->set_all_manifold_ids(0);
+        }
+  tria.set_manifold(0, cylinder_manifold);
+  manifold.initialize(tria);
+  tria.set_manifold(1, manifold);
+
+  do_test(tria);
+  tria.refine_global(1);
+  do_test(tria);
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test_spherical<2, 2>();
+  test_spherical<3, 3>();
+  test_cylinder();
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test MappingQCache::initialize_lazily() by comparison with an eagerly
+// initialized MappingQCache, filling the lazy cache from several threads
+// and checking that it stays usable without re-initialization after
+// refinement and coarsening of the mesh
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/fe/fe_nothing.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+template <int dim>
+void
+compare(const Triangulation<dim> &tria,
+        const MappingQCache<dim> &mapping_eager,
+        const MappingQCache<dim> &mapping_lazy)
+{
+  FE_Nothing<dim> fe;
+  QGauss<dim>     quadrature(3);
+
+  struct ScratchData
+  {
+    ScratchData(const MappingQCache<dim> &mapping_eager,
+                const MappingQCache<dim> &mapping_lazy,
+                const FE_Nothing<dim>    &fe,
+                const QGauss<dim>        &quadrature)
+      : fe_values_eager(mapping_eager,
+                        fe,
+                        quadrature,
+                        update_quadrature_points | update_JxW_values)
+      , fe_values_lazy(mapping_lazy,
+                       fe,
+                       quadrature,
+                       update_quadrature_points | update_JxW_values)
+    {}
+
+    ScratchData(const ScratchData &other)
+      : fe_values_eager(other.fe_values_eager.get_mapping(),
+                        other.fe_values_eager.get_fe(),
+                        other.fe_values_eager.get_quadrature(),
+                        other.fe_values_eager.get_update_flags())
+      , fe_values_lazy(other.fe_values_lazy.get_mapping(),
+                       other.fe_values_lazy.get_fe(),
+                       other.fe_values_lazy.get_quadrature(),
+                       other.fe_values_lazy.get_update_flags())
+    {}
+
+    FEValues<dim> fe_values_eager;
+    FEValues<dim> fe_values_lazy;
+  };
+
+  std::atomic<unsigned int> n_errors(0);
+  WorkStream::run(
+    tria.begin_active(),
+    tria.end(),
+    [&](const typename Triangulation<dim>::active_cell_iterator &cell,
+        ScratchData                                             &scratch,
+        unsigned int &) {
+      scratch.fe_values_eager.reinit(cell);
+      scratch.fe_values_lazy.reinit(cell);
+      for (const unsigned int q :
+           scratch.fe_values_eager.quadrature_point_indices())
+        if (scratch.fe_values_eager.quadrature_point(q).distance(
+              scratch.fe_values_lazy.quadrature_point(q)) > 1e-12 ||
+            std::abs(scratch.fe_values_eager.JxW(q) -
+                     scratch.fe_values_lazy.JxW(q)) > 1e-12)
+          ++n_errors;
+    },
+    [](const unsigned int &) {},
+    ScratchData(mapping_eager, mapping_lazy, fe, quadrature),
+    0U);
+
+  for (const auto &cell : tria.active_cell_iterators())
+    if (mapping_eager.get_vertices(cell) != mapping_lazy.get_vertices(cell))
+      ++n_errors;
+
+  deallog << "n_active_cells " << tria.n_active_cells() << ": "
+          << (n_errors == 0 ? "OK" : "FAILED") << std::endl;
+}
+
+
+
+template <int dim>
+void
+do_test(const unsigned int degree)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_ball(tria);
+  tria.refine_global(1);
+
+  deallog << "Testing degree " << degree << " in " << dim << 'D' << std::endl;
+
+  // a mapping of a different degree, so that the cache gets filled by
+  // FEValues, and one of the same degree, so that the support points are
+  // read off from the mapping
+  for (const unsigned int mapping_degree : {degree + 1, degree})
+    {
+      MappingQ<dim>      mapping(mapping_degree);
+      MappingQCache<dim> mapping_eager(degree);
+      MappingQCache<dim> mapping_lazy(degree);
+      mapping_eager.initialize(mapping, tria);
+      mapping_lazy.initialize_lazily(mapping, tria);
+      compare(tria, mapping_eager, mapping_lazy);
+
+      // the lazy cache resizes itself when the mesh changes, while the eager
+      // one must be initialized again
+      tria.refine_global(1);
+      mapping_eager.initialize(mapping, tria);
+      compare(tria, mapping_eager, mapping_lazy);
+
+      tria.coarsen_global(1);
+      mapping_eager.initialize(mapping, tria);
+      compare(tria, mapping_eager, mapping_lazy);
+    }
+}
+
+
+
+int
+main()
+{
+  initlog();
+  MultithreadInfo::set_thread_limit(4);
+
+  do_test<2>(2);
+  do_test<3>(2);
+}
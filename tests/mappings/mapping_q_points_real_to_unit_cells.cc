@@ -0,0 +1,135 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check Mapping::transform_points_real_to_unit_cells for MappingQ and
+// MappingCartesian against the function working on a single cell, with
+// points that are sorted by cells as well as with points where the cell
+// changes between every two points
+
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+void
+test(const Triangulation<dim> &tria, const Mapping<dim> &mapping)
+{
+  std::vector<Point<dim>> unit_points(3);
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      unit_points[0][d] = 0.2 + 0.1 * d;
+      unit_points[1][d] = 0.7 - 0.1 * d;
+      unit_points[2][d] = 0.5 + 0.2 * d;
+    }
+
+  for (const bool sorted_by_cells : {true, false})
+    {
+      std::vector<typename Triangulation<dim>::cell_iterator> cells;
+      std::vector<Point<dim>>                                 real_points;
+      if (sorted_by_cells)
+        {
+          for (const auto &cell : tria.active_cell_iterators())
+            for (const Point<dim> &unit_point : unit_points)
+              {
+                cells.push_back(cell);
+                real_points.push_back(
+                  mapping.transform_unit_to_real_cell(cell, unit_point));
+              }
+        }
+      else
+        {
+          for (const Point<dim> &unit_point : unit_points)
+            for (const auto &cell : tria.active_cell_iterators())
+              {
+                cells.push_back(cell);
+                real_points.push_back(
+                  mapping.transform_unit_to_real_cell(cell, unit_point));
+              }
+        }
+
+      std::vector<Point<dim>> batched_points(real_points.size());
+      mapping.transform_points_real_to_unit_cells(cells,
+                                                  real_points,
+                                                  batched_points);
+
+      double max_difference = 0;
+      for (unsigned int i = 0; i < real_points.size(); ++i)
+        {
+          Point<dim> unit_point;
+          mapping.transform_points_real_to_unit_cell(
+            cells[i],
+            make_array_view(real_points.begin() + i,
+                            real_points.begin() + i + 1),
+            make_array_view(&unit_point, &unit_point + 1));
+          max_difference =
+            std::max(max_difference, unit_point.distance(batched_points[i]));
+        }
+
+      deallog << "Points " << (sorted_by_cells ? "sorted" : "interleaved")
+              << ": " << real_points.size() << ", maximal difference "
+              << (max_difference < 1e-10 ? "below 1e-10" : "too large")
+              << std::endl;
+    }
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  {
+    Triangulation<dim> tria;
+    GridGenerator::hyper_shell(tria, Point<dim>(), 0.5, 1., dim == 2 ? 8 : 6);
+    tria.refine_global(1);
+
+    for (const unsigned int degree : {1, 3})
+      {
+        deallog << "MappingQ(" << degree << ")" << std::endl;
+        test(tria, MappingQ<dim>(degree));
+      }
+  }
+  {
+    Point<dim> upper_right;
+    for (unsigned int d = 0; d < dim; ++d)
+      upper_right[d] = 1. + d;
+    Triangulation<dim> tria;
+    GridGenerator::subdivided_hyper_rectangle(
+      tria, std::vector<unsigned int>(dim, 3), Point<dim>(), upper_right);
+    deallog << "MappingCartesian" << std::endl;
+    test(tria, MappingCartesian<dim>());
+  }
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,110 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that the MatrixFree variant of VectorTools::create_right_hand_side()
+// gives the same vector as the FEValues variant with the same quadrature
+// formula and hanging node constraints, for a scalar and a vector-valued
+// element.
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/vector_tools_rhs.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  const MappingQ<dim> mapping(1);
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_JxW_values | update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe.degree + 1),
+                     additional_data);
+
+  const Functions::CosineFunction<dim> rhs_function(fe.n_components());
+
+  LinearAlgebra::distributed::Vector<double> rhs_fe_values, rhs_matrix_free;
+  matrix_free.initialize_dof_vector(rhs_fe_values);
+  matrix_free.initialize_dof_vector(rhs_matrix_free);
+
+  VectorTools::create_right_hand_side(mapping,
+                                      dof_handler,
+                                      QGauss<dim>(fe.degree + 1),
+                                      rhs_function,
+                                      rhs_fe_values,
+                                      constraints);
+  VectorTools::create_right_hand_side(matrix_free,
+                                      rhs_function,
+                                      rhs_matrix_free);
+
+  rhs_matrix_free -= rhs_fe_values;
+  AssertThrow(rhs_matrix_free.linfty_norm() <
+                1e-12 * rhs_fe_values.linfty_norm(),
+              ExcInternalError());
+
+  deallog << fe.get_name() << ": OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(3));
+  test<2>(FESystem<2>(FE_Q<2>(2), 2));
+  test<3>(FE_Q<3>(2));
+  test<3>(FESystem<3>(FE_Q<3>(1), 3));
+}
@@ -0,0 +1,151 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the MatrixFree variant of KellyErrorEstimator::estimate()
+// computes the same indicators as the FEFaceValues-based implementation on
+// meshes with hanging nodes, for continuous and discontinuous elements
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/error_estimator.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+
+#include "../tests.h"
+
+
+
+// a smooth function that is not contained in the finite element space
+template <int dim>
+class Solution : public Function<dim>
+{
+public:
+  Solution(const unsigned int n_components)
+    : Function<dim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    double value = std::sin(p[0] + component);
+    for (unsigned int d = 1; d < dim; ++d)
+      value *= std::cos((d + 1.) * p[d]);
+    return value;
+  }
+};
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim>                         &fe,
+     const typename KellyErrorEstimator<dim>::Strategy strategy)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.last_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const MappingQ<dim> mapping(1);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+  additional_data.mapping_update_flags_inner_faces =
+    update_gradients | update_JxW_values | update_normal_vectors;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe.degree + 1),
+                     additional_data);
+
+  LinearAlgebra::distributed::Vector<double> solution;
+  matrix_free.initialize_dof_vector(solution);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Solution<dim>(fe.n_components()),
+                           solution);
+  constraints.distribute(solution);
+
+  Vector<float> error(tria.n_active_cells());
+  KellyErrorEstimator<dim>::estimate(
+    matrix_free, solution, error, 0, 0, strategy);
+
+  Vector<float> reference(tria.n_active_cells());
+  KellyErrorEstimator<dim>::estimate(
+    mapping,
+    dof_handler,
+    QGauss<dim - 1>(fe.degree + 1),
+    std::map<types::boundary_id, const Function<dim> *>(),
+    solution,
+    reference,
+    ComponentMask(),
+    nullptr,
+    numbers::invalid_unsigned_int,
+    numbers::invalid_subdomain_id,
+    numbers::invalid_material_id,
+    strategy);
+
+  AssertThrow(reference.l2_norm() > 0, ExcInternalError());
+  error -= reference;
+  AssertThrow(error.linfty_norm() < 1e-6 * reference.linfty_norm(),
+              ExcInternalError());
+
+  deallog << fe.get_name() << ", strategy " << strategy << ": OK"
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(2), KellyErrorEstimator<2>::cell_diameter_over_24);
+  test<2>(FE_Q<2>(3),
+          KellyErrorEstimator<2>::face_diameter_over_twice_max_degree);
+  test<2>(FESystem<2>(FE_Q<2>(2), 2), KellyErrorEstimator<2>::cell_diameter);
+  test<2>(FE_DGQ<2>(1), KellyErrorEstimator<2>::cell_diameter_over_24);
+  test<3>(FE_Q<3>(2), KellyErrorEstimator<3>::cell_diameter_over_24);
+  test<3>(FE_DGQ<3>(2),
+          KellyErrorEstimator<3>::face_diameter_over_twice_max_degree);
+}
@@ -0,0 +1,216 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that the MatrixFree variant of VectorTools::integrate_difference()
+// computes the same cellwise errors as the FEValues variant with the same
+// quadrature formula, for a scalar and a vector-valued element on a mesh
+// with hanging nodes, and for hp-finite elements.
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/mapping_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/vector_tools_integrate_difference.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const MappingQ<dim>       mapping(1);
+  const QGauss<1>           quadrature_1d(fe.degree + 1);
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values |
+    update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature_1d, additional_data);
+
+  // interpolate a function that is not in the finite element space, and
+  // compare against a different function
+  LinearAlgebra::distributed::Vector<double> solution;
+  matrix_free.initialize_dof_vector(solution);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::CosineFunction<dim>(fe.n_components()),
+                           solution);
+  const Functions::ExpFunction<dim> exact_solution;
+
+  for (const VectorTools::NormType norm : {VectorTools::L2_norm,
+                                           VectorTools::H1_seminorm,
+                                           VectorTools::H1_norm,
+                                           VectorTools::Linfty_norm})
+    {
+      Vector<double> difference_fe_values, difference_matrix_free;
+      if (fe.n_components() == 1)
+        {
+          VectorTools::integrate_difference(mapping,
+                                            dof_handler,
+                                            solution,
+                                            exact_solution,
+                                            difference_fe_values,
+                                            QGauss<dim>(fe.degree + 1),
+                                            norm);
+          VectorTools::integrate_difference(matrix_free,
+                                            solution,
+                                            exact_solution,
+                                            difference_matrix_free,
+                                            norm);
+        }
+      else
+        {
+          const Functions::ConstantFunction<dim> exact_vector(
+            1., fe.n_components());
+          VectorTools::integrate_difference(mapping,
+                                            dof_handler,
+                                            solution,
+                                            exact_vector,
+                                            difference_fe_values,
+                                            QGauss<dim>(fe.degree + 1),
+                                            norm);
+          VectorTools::integrate_difference(matrix_free,
+                                            solution,
+                                            exact_vector,
+                                            difference_matrix_free,
+                                            norm);
+        }
+
+      AssertDimension(difference_fe_values.size(),
+                      difference_matrix_free.size());
+      for (unsigned int i = 0; i < difference_fe_values.size(); ++i)
+        AssertThrow(std::abs(difference_fe_values[i] -
+                             difference_matrix_free[i]) <
+                      1e-12 * std::max(1., difference_fe_values[i]),
+                    ExcInternalError());
+    }
+
+  deallog << fe.get_name() << ": OK" << std::endl;
+}
+
+
+
+template <int dim>
+void
+test_hp()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+
+  const hp::FECollection<dim> fe(FE_Q<dim>(1), FE_Q<dim>(2));
+  DoFHandler<dim>             dof_handler(tria);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(cell->active_cell_index() % 2);
+  dof_handler.distribute_dofs(fe);
+
+  const MappingQ<dim>        mapping(1);
+  const hp::QCollection<1>   quadrature_1d(QGauss<1>(2), QGauss<1>(3));
+  const hp::QCollection<dim> quadrature(QGauss<dim>(2), QGauss<dim>(3));
+  AffineConstraints<double>  constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_gradients | update_JxW_values |
+    update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature_1d, additional_data);
+
+  LinearAlgebra::distributed::Vector<double> solution;
+  matrix_free.initialize_dof_vector(solution);
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           Functions::CosineFunction<dim>(),
+                           solution);
+  const Functions::ExpFunction<dim> exact_solution;
+
+  for (const VectorTools::NormType norm : {VectorTools::L2_norm,
+                                           VectorTools::H1_seminorm,
+                                           VectorTools::H1_norm,
+                                           VectorTools::Linfty_norm})
+    {
+      Vector<double> difference_fe_values, difference_matrix_free;
+      VectorTools::integrate_difference(hp::MappingCollection<dim>(mapping),
+                                        dof_handler,
+                                        solution,
+                                        exact_solution,
+                                        difference_fe_values,
+                                        quadrature,
+                                        norm);
+      VectorTools::integrate_difference(
+        matrix_free, solution, exact_solution, difference_matrix_free, norm);
+
+      AssertDimension(difference_fe_values.size(),
+                      difference_matrix_free.size());
+      for (unsigned int i = 0; i < difference_fe_values.size(); ++i)
+        AssertThrow(std::abs(difference_fe_values[i] -
+                             difference_matrix_free[i]) <
+                      1e-12 * std::max(1., difference_fe_values[i]),
+                    ExcInternalError());
+    }
+
+  deallog << "hp in " << dim << "d: OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_Q<2>(2));
+  test<2>(FESystem<2>(FE_Q<2>(1), 2));
+  test<3>(FE_Q<3>(1));
+  test<3>(FESystem<3>(FE_Q<3>(2), 3));
+  test_hp<2>();
+  test_hp<3>();
+}
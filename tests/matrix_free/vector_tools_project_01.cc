@@ -0,0 +1,187 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that the MatrixFree variant of VectorTools::project() reproduces
+// functions that are contained in the finite element space, both with the
+// cell-wise inverse mass matrix for discontinuous elements and with the
+// iterative solver for continuous elements with hanging nodes and
+// inhomogeneous boundary constraints, also for hp-finite elements
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/vector_tools_boundary.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+#include <deal.II/numerics/vector_tools_project.h>
+
+#include "../tests.h"
+
+
+
+// a quadratic polynomial with a different constant in each component
+template <int dim>
+class Quadratic : public Function<dim>
+{
+public:
+  Quadratic(const unsigned int n_components)
+    : Function<dim>(n_components)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int component) const override
+  {
+    double value = 1. + component + p[0];
+    for (unsigned int d = 1; d < dim; ++d)
+      value += (d + 1.) * p[d] * p[d];
+    return value;
+  }
+};
+
+
+
+template <int dim>
+void
+test(const FiniteElement<dim> &fe, const bool constrain_boundary)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  const Quadratic<dim> function(fe.n_components());
+  const MappingQ<dim>  mapping(1);
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  if (constrain_boundary)
+    VectorTools::interpolate_boundary_values(
+      mapping, dof_handler, 0, function, constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_JxW_values | update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(fe.degree + 1),
+                     additional_data);
+
+  LinearAlgebra::distributed::Vector<double> projection, interpolation;
+  VectorTools::project(matrix_free, constraints, function, projection);
+
+  matrix_free.initialize_dof_vector(interpolation);
+  VectorTools::interpolate(mapping, dof_handler, function, interpolation);
+
+  projection -= interpolation;
+  AssertThrow(projection.linfty_norm() < 1e-8 * interpolation.linfty_norm(),
+              ExcInternalError());
+
+  deallog << fe.get_name() << ": OK" << std::endl;
+}
+
+
+
+// the same for a collection of elements, which are assigned to the cells
+// in turn
+template <int dim>
+void
+test_hp(const hp::FECollection<dim> &fe)
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(2);
+
+  DoFHandler<dim> dof_handler(tria);
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    cell->set_active_fe_index(cell->active_cell_index() % fe.size());
+  dof_handler.distribute_dofs(fe);
+
+  const Quadratic<dim> function(fe.n_components());
+  const MappingQ<dim>  mapping(1);
+
+  hp::QCollection<1> quadrature;
+  for (unsigned int i = 0; i < fe.size(); ++i)
+    quadrature.push_back(QGauss<1>(fe[i].degree + 1));
+
+  AffineConstraints<double> constraints;
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    update_values | update_JxW_values | update_quadrature_points;
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, quadrature, additional_data);
+
+  LinearAlgebra::distributed::Vector<double> projection, interpolation;
+  VectorTools::project(matrix_free, constraints, function, projection);
+
+  matrix_free.initialize_dof_vector(interpolation);
+  VectorTools::interpolate(mapping, dof_handler, function, interpolation);
+
+  projection -= interpolation;
+  AssertThrow(projection.linfty_norm() < 1e-8 * interpolation.linfty_norm(),
+              ExcInternalError());
+
+  deallog << "hp";
+  for (unsigned int i = 0; i < fe.size(); ++i)
+    deallog << ' ' << fe[i].get_name();
+  deallog << ": OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test<2>(FE_DGQ<2>(2), false);
+  test<2>(FESystem<2>(FE_DGQ<2>(2), 2), false);
+  test<2>(FE_Q<2>(2), false);
+  test<2>(FESystem<2>(FE_Q<2>(3), 2), true);
+  test<3>(FE_DGQ<3>(2), false);
+  test<3>(FE_Q<3>(2), true);
+  test_hp<2>(hp::FECollection<2>(FE_DGQ<2>(2), FE_DGQ<2>(3)));
+  test_hp<2>(hp::FECollection<2>(FE_Q<2>(2), FE_Q<2>(3)));
+  test_hp<3>(hp::FECollection<3>(FE_DGQ<3>(2), FE_DGQ<3>(3)));
+}
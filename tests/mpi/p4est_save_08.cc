@@ -0,0 +1,199 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// save a triangulation with three solution vectors using the indexed
+// checkpoint layout, and load only a subset of them in a different order,
+// both on all and on a smaller number of processes
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/utilities.h>
+
+#include <deal.II/distributed/solution_transfer.h>
+#include <deal.II/distributed/tria.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+class TestFunction : public Function<dim>
+{
+public:
+  TestFunction(const unsigned int index)
+    : Function<dim>(1)
+    , index(index)
+  {}
+
+  virtual double
+  value(const Point<dim> &p, const unsigned int = 0) const override
+  {
+    return (index + 1) * p[0] + p[1] * p[1];
+  }
+
+private:
+  const unsigned int index;
+};
+
+
+
+template <int dim>
+void
+load_and_check(const std::string &filename, const MPI_Comm comm)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  parallel::distributed::Triangulation<dim> tr(comm);
+  GridGenerator::hyper_cube(tr);
+
+  // only load the third and the first vector, in this order
+  const std::vector<unsigned int> selection = {2, 0};
+  tr.load(filename, selection);
+
+  FE_Q<dim>       fe(1);
+  DoFHandler<dim> dh(tr);
+  dh.distribute_dofs(fe);
+
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dh);
+
+  for (const unsigned int i : selection)
+    {
+      VectorType solution(dh.locally_owned_dofs(), locally_relevant_dofs, comm);
+      parallel::distributed::SolutionTransfer<dim, VectorType> soltrans(dh);
+      soltrans.deserialize(solution);
+
+      VectorType reference(dh.locally_owned_dofs(),
+                           locally_relevant_dofs,
+                           comm);
+      VectorTools::interpolate(dh, TestFunction<dim>(i), reference);
+
+      reference -= solution;
+      if (Utilities::MPI::this_mpi_process(comm) == 0)
+        deallog << "n_procs=" << Utilities::MPI::n_mpi_processes(comm)
+                << " vector " << i << " error: " << reference.linfty_norm()
+                << std::endl;
+    }
+
+  if (Utilities::MPI::this_mpi_process(comm) == 0)
+    deallog << "#cells = " << tr.n_global_active_cells() << std::endl;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  const std::string filename = "dat";
+  {
+    parallel::distributed::Triangulation<dim> tr(
+      MPI_COMM_WORLD,
+      Triangulation<dim>::none,
+      parallel::distributed::Triangulation<dim>::indexed_checkpoints);
+
+    GridGenerator::hyper_cube(tr);
+    tr.refine_global(2);
+    for (const auto &cell : tr.active_cell_iterators())
+      if (cell->is_locally_owned() && cell->center().norm() < 0.3)
+        cell->set_refine_flag();
+    tr.execute_coarsening_and_refinement();
+
+    FE_Q<dim>       fe(1);
+    DoFHandler<dim> dh(tr);
+    dh.distribute_dofs(fe);
+
+    const IndexSet locally_relevant_dofs =
+      DoFTools::extract_locally_relevant_dofs(dh);
+
+    std::vector<VectorType> solutions(3);
+    std::vector<std::unique_ptr<
+      parallel::distributed::SolutionTransfer<dim, VectorType>>>
+      soltrans(3);
+    for (unsigned int i = 0; i < 3; ++i)
+      {
+        solutions[i].reinit(dh.locally_owned_dofs(),
+                            locally_relevant_dofs,
+                            MPI_COMM_WORLD);
+        VectorTools::interpolate(dh, TestFunction<dim>(i), solutions[i]);
+        solutions[i].update_ghost_values();
+
+        soltrans[i] = std::make_unique<
+          parallel::distributed::SolutionTransfer<dim, VectorType>>(dh);
+        soltrans[i]->prepare_for_serialization(solutions[i]);
+      }
+
+    tr.save(filename);
+
+    if (myid == 0)
+      deallog << "#cells = " << tr.n_global_active_cells() << std::endl;
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // load on all processes
+  load_and_check<dim>(filename, MPI_COMM_WORLD);
+
+  // load on a subset of the processes
+  MPI_Comm sub_comm;
+  MPI_Comm_split(MPI_COMM_WORLD,
+                 (myid < 2) ? 0 : MPI_UNDEFINED,
+                 myid,
+                 &sub_comm);
+  if (myid < 2)
+    {
+      load_and_check<dim>(filename, sub_comm);
+      MPI_Comm_free(&sub_comm);
+    }
+
+  if (myid == 0)
+    deallog << "OK" << std::endl;
+}
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  const unsigned int myid = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  deallog.push(Utilities::int_to_string(myid));
+
+  if (myid == 0)
+    {
+      initlog();
+
+      deallog.push("2d");
+      test<2>();
+      deallog.pop();
+    }
+  else
+    test<2>();
+}
@@ -0,0 +1,93 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that BoundingVolumeHierarchy::query() returns the same boxes as a
+// brute-force search over overlapping random boxes, for single points and
+// for a batch of points.
+
+#include <deal.II/base/bounding_box.h>
+
+#include <deal.II/numerics/bounding_volume_hierarchy.h>
+
+#include "../tests.h"
+
+template <int dim>
+void
+test()
+{
+  std::vector<std::pair<BoundingBox<dim>, unsigned int>> boxes;
+  for (unsigned int i = 0; i < 200; ++i)
+    {
+      const Point<dim> center = random_point<dim>();
+      Point<dim>       lower, upper;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          const double h = 0.02 + 0.1 * random_value<double>();
+          lower[d]       = center[d] - h;
+          upper[d]       = center[d] + h;
+        }
+      boxes.emplace_back(BoundingBox<dim>(std::make_pair(lower, upper)), i);
+    }
+
+  const BoundingVolumeHierarchy<dim, unsigned int> bvh(boxes, 4);
+  deallog << "Number of boxes: " << bvh.size() << std::endl;
+
+  std::vector<Point<dim>> points;
+  for (unsigned int i = 0; i < 500; ++i)
+    points.push_back(random_point<dim>(-0.1, 1.1));
+
+  const double tolerance = 0.01;
+  const auto   batch     = bvh.query(points, tolerance);
+
+  unsigned int n_hits = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      std::vector<unsigned int> expected;
+      for (const auto &box : boxes)
+        {
+          bool inside = true;
+          for (unsigned int d = 0; d < dim; ++d)
+            if (points[i][d] < box.first.lower_bound(d) - tolerance ||
+                points[i][d] > box.first.upper_bound(d) + tolerance)
+              inside = false;
+          if (inside)
+            expected.push_back(box.second);
+        }
+
+      const std::vector<unsigned int> found = bvh.query(points[i], tolerance);
+      AssertThrow(found == expected, ExcInternalError());
+      AssertThrow(batch[i] == expected, ExcInternalError());
+      n_hits += found.size();
+    }
+  AssertThrow(n_hits > 0, ExcInternalError());
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
@@ -0,0 +1,112 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that VectorTools::interpolate() and
+// VectorTools::interpolate_boundary_values(), which loop over the cells in
+// parallel, give the same results with one and with several threads,
+// including a component mask that leaves some entries untouched.
+
+#include <deal.II/base/function_lib.h>
+#include <deal.II/base/multithread_info.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/vector_tools_boundary.h>
+#include <deal.II/numerics/vector_tools_interpolate.h>
+
+#include "../tests.h"
+
+
+
+template <int dim>
+void
+compute(const DoFHandler<dim>                     &dof_handler,
+        Vector<double>                            &vec,
+        std::map<types::global_dof_index, double> &boundary_values)
+{
+  const MappingQ<dim>                  mapping(2);
+  const Functions::CosineFunction<dim> function(2);
+
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    vec(i) = i;
+  VectorTools::interpolate(mapping,
+                           dof_handler,
+                           function,
+                           vec,
+                           ComponentMask(std::vector<bool>{true, false}));
+
+  boundary_values.clear();
+  VectorTools::interpolate_boundary_values(
+    mapping, dof_handler, 0, function, boundary_values);
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria, -1, 1);
+  tria.refine_global(dim == 2 ? 3 : 2);
+
+  const FESystem<dim> fe(FE_Q<dim>(2), 2);
+  DoFHandler<dim>     dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double>                            vec_serial(dof_handler.n_dofs());
+  std::map<types::global_dof_index, double> boundary_values_serial;
+  MultithreadInfo::set_thread_limit(1);
+  compute(dof_handler, vec_serial, boundary_values_serial);
+
+  Vector<double>                            vec(dof_handler.n_dofs());
+  std::map<types::global_dof_index, double> boundary_values;
+  MultithreadInfo::set_thread_limit();
+  compute(dof_handler, vec, boundary_values);
+
+  for (unsigned int i = 0; i < vec.size(); ++i)
+    AssertThrow(vec(i) == vec_serial(i), ExcInternalError());
+  AssertThrow(boundary_values == boundary_values_serial, ExcInternalError());
+
+  deallog << "Number of boundary values: " << boundary_values.size()
+          << std::endl;
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}
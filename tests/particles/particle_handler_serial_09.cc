@@ -0,0 +1,151 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check property columns of the property pool: values are kept with their
+// particles while the particles are sorted into cells, each cell's values
+// are contiguous afterwards, and they survive a round trip through the
+// serialization functions.
+
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+void
+test()
+{
+  {
+    const int dim      = 2;
+    const int spacedim = 2;
+
+    Triangulation<dim, spacedim> tr;
+
+    GridGenerator::hyper_cube(tr);
+    tr.refine_global(1);
+    MappingQ<dim, spacedim> mapping(1);
+
+    Particles::ParticleHandler<dim, spacedim> particle_handler(tr, mapping);
+
+    // Insert two particles per cell, all with the first cell as the hint, so
+    // that the particles of one cell are not adjacent in memory before
+    // sorting
+    for (unsigned int i = 0; i < 2 * tr.n_active_cells(); ++i)
+      {
+        const unsigned int c = i % tr.n_active_cells();
+        Point<spacedim>    position;
+        position[0] = 0.5 * (c % 2) + 0.1 + 0.2 * (i / tr.n_active_cells());
+        position[1] = 0.5 * (c / 2) + 0.25;
+
+        particle_handler.insert_particle(position,
+                                         Point<dim>(),
+                                         i,
+                                         tr.begin_active());
+      }
+
+    Particles::PropertyPool<dim, spacedim> &pool =
+      particle_handler.get_property_pool();
+    const unsigned int double_column = pool.add_property_column<double>();
+    const unsigned int int_column    = pool.add_property_column<int>();
+    deallog << "Number of columns: " << pool.n_property_columns() << std::endl;
+
+    for (const auto &particle : particle_handler)
+      {
+        pool.get_property_column<double>(
+          double_column)[particle.get_local_index()] = particle.get_id() + 0.5;
+        pool.get_property_column<int>(int_column)[particle.get_local_index()] =
+          10 * particle.get_id();
+      }
+
+    particle_handler.sort_particles_into_subdomains_and_cells();
+
+    for (const auto &cell : tr.active_cell_iterators())
+      {
+        const ArrayView<double> doubles =
+          particle_handler.get_property_column_in_cell<double>(double_column,
+                                                               cell);
+        const ArrayView<int> ints =
+          particle_handler.get_property_column_in_cell<int>(int_column, cell);
+
+        deallog << "Cell " << cell << ':';
+        for (const double v : doubles)
+          deallog << ' ' << v;
+        deallog << " |";
+        for (const int v : ints)
+          deallog << ' ' << v;
+        deallog << std::endl;
+
+        // Scale the values of the cell with a vectorized loop
+        const unsigned int n_lanes = VectorizedArray<double>::size();
+        unsigned int       i       = 0;
+        for (; i + n_lanes <= doubles.size(); i += n_lanes)
+          {
+            VectorizedArray<double> value;
+            value.load(doubles.data() + i);
+            value *= 2.;
+            value.store(doubles.data() + i);
+          }
+        for (; i < doubles.size(); ++i)
+          doubles[i] *= 2.;
+      }
+
+    // Write all particles to a buffer and read them back, which moves the
+    // column values through the serialization functions
+    std::vector<char> buffer;
+    for (const auto &particle : particle_handler)
+      {
+        const std::size_t offset = buffer.size();
+        buffer.resize(offset + particle.serialized_size_in_bytes());
+        void *end = particle.write_particle_data_to_memory(buffer.data() +
+                                                           offset);
+        AssertThrow(static_cast<char *>(end) == buffer.data() + buffer.size(),
+                    ExcInternalError());
+      }
+
+    for (const auto &particle : particle_handler)
+      pool.get_property_column<double>(
+        double_column)[particle.get_local_index()] = 0;
+
+    const void *data = buffer.data();
+    for (auto &particle : particle_handler)
+      data = particle.read_particle_data_from_memory(data);
+
+    for (const auto &particle : particle_handler)
+      deallog << "Particle " << particle.get_id() << ": "
+              << pool.get_property_column<double>(
+                   double_column)[particle.get_local_index()]
+              << ' '
+              << pool.get_property_column<int>(
+                   int_column)[particle.get_local_index()]
+              << std::endl;
+  }
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
@@ -0,0 +1,117 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check the automatic compaction of the particle storage in
+// ParticleHandler::remove_particles() and its threshold, as well as
+// ParticleHandler::compact_particle_storage()
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <limits>
+
+#include "../tests.h"
+
+
+template <int dim, int spacedim>
+void
+print_storage(const Particles::ParticleHandler<dim, spacedim> &particle_handler)
+{
+  deallog << "ids:";
+  for (const auto &particle : particle_handler)
+    deallog << ' ' << particle.get_id();
+  deallog << std::endl;
+
+  deallog << "local indices:";
+  for (const auto &particle : particle_handler)
+    deallog << ' ' << particle.get_local_index();
+  deallog << std::endl;
+
+  deallog << "max local index: "
+          << particle_handler.get_max_local_particle_index() << std::endl;
+}
+
+
+
+void
+test()
+{
+  {
+    const int dim      = 2;
+    const int spacedim = 2;
+
+    Triangulation<dim, spacedim> tr;
+
+    GridGenerator::hyper_cube(tr);
+    tr.refine_global(1);
+    MappingQ<dim, spacedim> mapping(1);
+
+    Particles::ParticleHandler<dim, spacedim> particle_handler(tr, mapping);
+
+    // Insert two particles per cell, cycling through the cells, so that the
+    // particles of one cell do not occupy adjacent memory slots
+    for (unsigned int i = 0; i < 2 * tr.n_active_cells(); ++i)
+      {
+        const auto cell = std::next(tr.begin_active(), i % tr.n_active_cells());
+        particle_handler.insert_particle(cell->center(), Point<dim>(), i, cell);
+      }
+
+    deallog << "After insertion" << std::endl;
+    print_storage(particle_handler);
+
+    // With automatic compaction enabled, removing a particle now exceeds the
+    // threshold and compacts the storage
+    particle_handler.set_storage_compaction_threshold(0.25);
+    const auto first_cell_particles =
+      particle_handler.particles_in_cell(tr.begin_active());
+    particle_handler.remove_particles(
+      {std::next(first_cell_particles.begin())});
+
+    deallog << "After removing particle 4" << std::endl;
+    print_storage(particle_handler);
+
+    // Without automatic compaction, which is the default, the removal leaves
+    // a gap behind
+    particle_handler.set_storage_compaction_threshold(
+      std::numeric_limits<double>::infinity());
+    const auto second_cell_particles =
+      particle_handler.particles_in_cell(std::next(tr.begin_active()));
+    particle_handler.remove_particles({second_cell_particles.begin()});
+
+    deallog << "After removing particle 1" << std::endl;
+    print_storage(particle_handler);
+
+    particle_handler.compact_particle_storage();
+
+    deallog << "After compaction" << std::endl;
+    print_storage(particle_handler);
+  }
+
+  deallog << "OK" << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// check that sort_particles_into_subdomains_and_cells(), which searches the
+// new cells of the particles in parallel, finds the right cell and reference
+// location for many particles and reports all lost particles
+
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include "../tests.h"
+
+
+void
+test()
+{
+  const int dim = 2;
+
+  Triangulation<dim> tr;
+  GridGenerator::hyper_cube(tr);
+  tr.refine_global(3);
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(tr, mapping);
+
+  std::vector<Point<dim>> positions;
+  for (unsigned int j = 0; j < 20; ++j)
+    for (unsigned int i = 0; i < 20; ++i)
+      positions.emplace_back((i + 0.5) / 20, (j + 0.5) / 20);
+  particle_handler.insert_particles(positions);
+
+  unsigned int n_lost = 0;
+  particle_handler.signals.particle_lost.connect(
+    [&n_lost](const auto &, const auto &) { ++n_lost; });
+
+  // Move the particles across several cells, and some of them out of the
+  // domain
+  const Tensor<1, dim> shift({0.3, 0.1});
+  for (auto &particle : particle_handler)
+    particle.set_location(particle.get_location() + shift);
+
+  particle_handler.sort_particles_into_subdomains_and_cells();
+
+  deallog << "Particles: " << particle_handler.n_locally_owned_particles()
+          << ", lost: " << n_lost << std::endl;
+
+  unsigned int n_wrong = 0;
+  for (const auto &particle : particle_handler)
+    {
+      const Point<dim> reference_location =
+        mapping.transform_real_to_unit_cell(particle.get_surrounding_cell(),
+                                            particle.get_location());
+      if (!GeometryInfo<dim>::is_inside_unit_cell(reference_location, 1e-12) ||
+          reference_location.distance(particle.get_reference_location()) >
+            1e-12)
+        ++n_wrong;
+    }
+  deallog << "Particles with wrong cell or reference location: " << n_wrong
+          << std::endl;
+}
+
+
+
+int
+main()
+{
+  initlog();
+
+  test();
+}
@@ -0,0 +1,124 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+
+// Test Utilities::MPI::RemotePointEvaluation::reinit_incremental() for
+// points that move a little, move far, and leave the domain: the positions
+// reconstructed from the reference points of the evaluating processes have
+// to agree with the points, and the same points have to be found as with a
+// new call to reinit().
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools_cache.h>
+
+#include "../tests.h"
+
+
+
+void
+test()
+{
+  const unsigned int dim  = 2;
+  const unsigned int rank = Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+
+  parallel::shared::Triangulation<dim> tria(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+
+  const MappingQ1<dim>        mapping;
+  const GridTools::Cache<dim> cache(tria, mapping);
+
+  Utilities::MPI::RemotePointEvaluation<dim> rpe(
+    Utilities::MPI::RemotePointEvaluation<dim>::AdditionalData(1e-6, true));
+
+  // the last two steps move the points far, out of the domain, and back
+  const std::vector<Point<dim>> displacements = {Point<dim>(0., 0.),
+                                                 Point<dim>(0.01, 0.02),
+                                                 Point<dim>(0.02, 0.04),
+                                                 Point<dim>(0.3, 0.1),
+                                                 Point<dim>(0.31, 0.12),
+                                                 Point<dim>(0., 0.)};
+
+  for (unsigned int step = 0; step < displacements.size(); ++step)
+    {
+      std::vector<Point<dim>> points;
+      for (unsigned int i = 0; i < 10; ++i)
+        points.emplace_back(Point<dim>(0.05 + 0.09 * i, 0.3 + 0.1 * rank) +
+                            displacements[step]);
+
+      // the first call does the global search and keeps the point locations
+      // for the later updates
+      rpe.reinit_incremental(cache, points);
+
+      const std::vector<double> values = rpe.evaluate_and_process<double>(
+        [&](const ArrayView<double> &values, const auto &cell_data) {
+          for (const auto cell : cell_data.cell_indices())
+            {
+              const auto unit_points = cell_data.get_unit_points(cell);
+              const auto local_values = cell_data.get_data_view(cell, values);
+              for (unsigned int q = 0; q < unit_points.size(); ++q)
+                {
+                  const Point<dim> point =
+                    mapping.transform_unit_to_real_cell(
+                      cell_data.get_active_cell_iterator(cell), unit_points[q]);
+                  local_values[q] = point[0] + 2. * point[1];
+                }
+            }
+        });
+
+      Utilities::MPI::RemotePointEvaluation<dim> rpe_new(
+        Utilities::MPI::RemotePointEvaluation<dim>::AdditionalData(1e-6,
+                                                                   true));
+      rpe_new.reinit(cache, points);
+
+      const std::vector<unsigned int> &point_ptrs = rpe.get_point_ptrs();
+      unsigned int                     n_found    = 0;
+      for (unsigned int i = 0; i < points.size(); ++i)
+        {
+          AssertThrow(rpe.point_found(i) == rpe_new.point_found(i),
+                      ExcInternalError());
+          if (rpe.point_found(i))
+            {
+              AssertThrow(point_ptrs[i + 1] - point_ptrs[i] == 1,
+                          ExcInternalError());
+              AssertThrow(std::abs(values[point_ptrs[i]] - points[i][0] -
+                                   2. * points[i][1]) < 1e-12,
+                          ExcInternalError());
+              ++n_found;
+            }
+        }
+
+      deallog << "Step " << step << ": " << n_found << " points found"
+              << std::endl;
+    }
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  test();
+}
@@ -0,0 +1,103 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2026 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+// check that the partition_hilbert scheme of a shared triangulation takes
+// the cell weights attached to the weight signal into account: the result
+// has to agree with GridTools::partition_triangulation_hilbert() called
+// with the same weights, and the cells of one quadrant are weighted so
+// heavily that the number of cells per subdomain differs
+
+#include <deal.II/distributed/shared_tria.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "../tests.h"
+
+
+template <int dim>
+unsigned int
+weight(const typename Triangulation<dim>::cell_iterator &cell)
+{
+  bool in_corner = true;
+  for (unsigned int d = 0; d < dim; ++d)
+    if (cell->center()[d] > 0.5)
+      in_corner = false;
+  return in_corner ? 7 : 1;
+}
+
+
+
+template <int dim>
+void
+test()
+{
+  parallel::shared::Triangulation<dim> shared_tria(
+    MPI_COMM_WORLD,
+    Triangulation<dim>::none,
+    false,
+    parallel::shared::Triangulation<dim>::partition_hilbert);
+  shared_tria.signals.weight.connect(
+    [](const typename Triangulation<dim>::cell_iterator &cell,
+       const CellStatus) { return weight<dim>(cell); });
+  GridGenerator::hyper_cube(shared_tria);
+  shared_tria.refine_global(3);
+
+  Triangulation<dim> tria;
+  GridGenerator::hyper_cube(tria);
+  tria.refine_global(3);
+  std::vector<unsigned int> cell_weights(tria.n_active_cells());
+  for (const auto &cell : tria.active_cell_iterators())
+    cell_weights[cell->active_cell_index()] = weight<dim>(cell);
+  GridTools::partition_triangulation_hilbert(2, tria, cell_weights);
+
+  bool                      same_partition = true;
+  std::vector<unsigned int> n_cells(2), subdomain_weights(2);
+  for (const auto &cell : shared_tria.active_cell_iterators())
+    {
+      if (cell->subdomain_id() !=
+          tria.create_cell_iterator(cell->id())->subdomain_id())
+        same_partition = false;
+      ++n_cells[cell->subdomain_id()];
+      subdomain_weights[cell->subdomain_id()] += weight<dim>(cell);
+    }
+
+  deallog << "Same partition as GridTools: " << same_partition << std::endl;
+  deallog << "Weights balanced: "
+          << (std::abs(static_cast<int>(subdomain_weights[0]) -
+                       static_cast<int>(subdomain_weights[1])) <= 2 * 7)
+          << std::endl;
+  deallog << "Same number of cells: " << (n_cells[0] == n_cells[1])
+          << std::endl;
+}
+
+
+
+int
+main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  MPILogInitAll                    all;
+
+  deallog.push("2d");
+  test<2>();
+  deallog.pop();
+  deallog.push("3d");
+  test<3>();
+  deallog.pop();
+}